@@ -4,11 +4,33 @@
 #include <algorithm>
 #include <array>
 #include <bit>
+#include <bitset>
 #include <charconv>
 #include <climits>
+#include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <exception>
+#include <limits>
+#include <span>
+#include <string_view>
 #include <system_error>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+#ifdef CHARCONV_EXT_IOSTREAM
+#include <istream>
+#include <ostream>
+#endif
+
+#ifdef CHARCONV_EXT_FD_WRITER
+#include <cerrno>
+#include <new>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
 
 #ifdef BITINT_MAXWIDTH
 #define CHARCONV_EXT_BITINT_MAXWIDTH BITINT_MAXWIDTH
@@ -29,6 +51,63 @@
 #endif
 #endif
 
+// SIMD kernels are only used outside of constant evaluation
+// and can be disabled entirely by defining CHARCONV_EXT_NO_SIMD.
+#if !defined(CHARCONV_EXT_NO_SIMD) && defined(__SSE2__)
+#define CHARCONV_EXT_SSE2 1
+#include <emmintrin.h>
+#endif
+
+// Kernels for newer instruction sets are compiled with function-level target attributes
+// and selected at run time, so they don't require any compiler flags.
+#if !defined(CHARCONV_EXT_NO_SIMD) && defined(__x86_64__)
+#define CHARCONV_EXT_X86_DISPATCH 1
+#include <immintrin.h>
+#endif
+
+// Defining CHARCONV_EXT_USDT adds USDT (user-level statically defined tracing) probes
+// with the provider "charconv_ext" to the slow paths, so that tools like bpftrace
+// can count and inspect them at run time.
+// Every probe is a single nop, whose name and arguments are described in an ELF note
+// in the format of <sys/sdt.h>, which is not required.
+// The arguments of every probe are the length of the text and the base.
+#if defined(CHARCONV_EXT_USDT) && defined(__ELF__) && (defined(__x86_64__) || defined(__aarch64__))
+#define CHARCONV_EXT_PROBE(name, length, base)                                                     \
+    do {                                                                                           \
+        if (!::std::is_constant_evaluated()) {                                                     \
+            __asm__ __volatile__(                                                                  \
+                "990: nop\n"                                                                       \
+                ".pushsection .note.stapsdt,\"?\",\"note\"\n"                                      \
+                ".balign 4\n"                                                                      \
+                ".4byte 992f-991f, 994f-993f, 3\n"                                                 \
+                "991: .asciz \"stapsdt\"\n"                                                        \
+                "992: .balign 4\n"                                                                 \
+                "993: .8byte 990b\n"                                                               \
+                ".8byte _.stapsdt.base\n"                                                          \
+                ".8byte 0\n"                                                                       \
+                ".asciz \"charconv_ext\"\n"                                                        \
+                ".asciz \"" #name "\"\n"                                                           \
+                ".asciz \"-8@%0 -4@%1\"\n"                                                         \
+                "994: .balign 4\n"                                                                 \
+                ".popsection\n"                                                                    \
+                ".ifndef _.stapsdt.base\n"                                                         \
+                ".pushsection .stapsdt.base,\"aG\",\"progbits\",.stapsdt.base,comdat\n"            \
+                ".weak _.stapsdt.base\n"                                                           \
+                ".hidden _.stapsdt.base\n"                                                         \
+                "_.stapsdt.base: .space 1\n"                                                       \
+                ".size _.stapsdt.base, 1\n"                                                        \
+                ".popsection\n"                                                                    \
+                ".endif\n"                                                                         \
+                :                                                                                  \
+                : "nor"(static_cast<::std::int64_t>(length)),                                      \
+                  "nor"(static_cast<::std::int32_t>(base))                                         \
+            );                                                                                     \
+        }                                                                                          \
+    } while (false)
+#else
+#define CHARCONV_EXT_PROBE(name, length, base) static_cast<void>(0)
+#endif
+
 #ifdef __GLIBCXX_BITSIZE_INT_N_0
 #if __GLIBCXX_BITSIZE_INT_N_0 == 128
 #define CHARCONV_EXT_128_BIT_PROVIDED_BY_STANDARD_LIBRARY 1
@@ -53,12 +132,6 @@ __extension__ typedef unsigned __int128 uint128_t; // NOLINT modernize-use-using
 #error "Only Clang and GCC are supported."
 #endif
 
-// Recent versions of GCC and Clang (~2025) already provide support for __int128
-// in to_chars and from_chars, so we should avoid
-#if !defined(CHARCONV_EXT_128_BIT_PROVIDED_BY_STANDARD_LIBRARY)                                    \
-    || defined(CHARCONV_EXT_DONT_USE_STANDARD_LIBRARY)
-#define CHARCONV_EXT_128_BIT_IMPLEMENTATION 1
-
 namespace detail {
 
 [[nodiscard]]
@@ -148,19 +221,48 @@ constexpr bool mul_overflow(uint128_t& out, const uint128_t x, const uint128_t y
     return __builtin_mul_overflow(x, y, &out);
 }
 
+/// @brief Returns the upper 128 bits of the 256-bit product `x * y`.
 [[nodiscard]]
-constexpr int digit_value(char c)
+constexpr uint128_t umul128_hi(const uint128_t x, const uint128_t y) noexcept
 {
-    if (c >= '0' && c <= '9') {
-        return c - '0';
-    }
-    if (c >= 'A' && c <= 'Z') {
-        return c - 'A' + 10;
-    }
-    if (c >= 'a' && c <= 'z') {
-        return c - 'a' + 10;
+    const auto x_lo = std::uint64_t(x);
+    const auto x_hi = std::uint64_t(x >> 64);
+    const auto y_lo = std::uint64_t(y);
+    const auto y_hi = std::uint64_t(y >> 64);
+
+    const uint128_t lo_lo = uint128_t(x_lo) * y_lo;
+    const uint128_t hi_lo = uint128_t(x_hi) * y_lo;
+    const uint128_t lo_hi = uint128_t(x_lo) * y_hi;
+    const uint128_t hi_hi = uint128_t(x_hi) * y_hi;
+
+    const uint128_t middle = (lo_lo >> 64) + std::uint64_t(hi_lo) + std::uint64_t(lo_hi);
+    return hi_hi + (hi_lo >> 64) + (lo_hi >> 64) + (middle >> 64);
+}
+
+inline constexpr auto digit_value_table = []() consteval {
+    std::array<signed char, 256> result {};
+    for (std::size_t c = 0; c < result.size(); ++c) {
+        if (c >= '0' && c <= '9') {
+            result[c] = static_cast<signed char>(c - '0');
+        }
+        else if (c >= 'A' && c <= 'Z') {
+            result[c] = static_cast<signed char>(c - 'A' + 10);
+        }
+        else if (c >= 'a' && c <= 'z') {
+            result[c] = static_cast<signed char>(c - 'a' + 10);
+        }
+        else {
+            result[c] = -1;
+        }
     }
-    return -1;
+    return result;
+}();
+
+/// @brief Returns the value of `c` as a digit in base 36, or `-1` if it is not a digit.
+[[nodiscard]]
+constexpr int digit_value(const char c)
+{
+    return digit_value_table[static_cast<unsigned char>(c)];
 }
 
 [[nodiscard]]
@@ -177,398 +279,4453 @@ pattern_length(const char* const first, const char* const last, const int base)
     return result;
 }
 
-} // namespace detail
+// 64-BIT DIGIT ENGINE
+// ===================
+// The following functions format and parse at most 64 bits worth of digits.
+// Unlike std::to_chars and std::from_chars, they operate in "known-length" mode:
+// the caller has already determined how many digits there are
+// (or how many zero-padded digits it wants),
+// so no length detection or validation is repeated for every chunk.
 
-/// @brief Implements the interface of `to_chars` for decimal input of 128-bit integers.
-/// In the "happy case" of having at most 19 digits,
-/// this simply calls `std::from_chars` for 64-bit integers.
-/// In the worst case, three such 64-bit calls are needed,
-/// handling 19 digits at a time, with 39 decimal digits being the maximum for 128-bit.
-constexpr std::from_chars_result
-from_chars(const char* const first, const char* const last, uint128_t& out, int base = 10)
-{
-    CHARCONV_EXT_ASSERT(base >= 2);
-    CHARCONV_EXT_ASSERT(base <= 36);
-    CHARCONV_EXT_ASSERT(first);
-    CHARCONV_EXT_ASSERT(last);
+inline constexpr char digit_chars[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+inline constexpr char upper_digit_chars[] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ";
 
-    if (first == last) {
-        return { last, std::errc::invalid_argument };
+inline constexpr auto decimal_digit_pairs = []() consteval {
+    std::array<char, 200> result {};
+    for (std::size_t i = 0; i < 100; ++i) {
+        result[2 * i] = char('0' + i / 10);
+        result[2 * i + 1] = char('0' + i % 10);
     }
+    return result;
+}();
 
-    const char* const initial_last = first + detail::pattern_length(first, last, base);
-
-    uint128_t result = 0;
-    const char* current_last = initial_last;
-
-    const std::uint64_t max_pow = detail::u64_max_power(base);
-    const std::ptrdiff_t max_lower_length = detail::u64_max_representable_digits(base);
-    const bool is_pow_2 = (base & (base - 1)) == 0;
-    CHARCONV_EXT_ASSERT(max_pow != 0 || is_pow_2);
-
-    if (is_pow_2) {
-        const int bits_per_iteration = std::countr_zero(max_pow);
-        int shift = 0;
-
-        while (true) {
-            const auto lower_length = std::min(current_last - first, max_lower_length);
-            const char* const current_first = current_last - lower_length;
-
-            std::uint64_t digits {};
-            const std::from_chars_result partial_result
-                = std::from_chars(current_first, current_last, digits, base);
-            if (partial_result.ec != std::errc {}) {
-                // Since we only handle as many digits as can fit into a 64-bit integer,
-                // the only possible failure should be an invalid string.
-                CHARCONV_EXT_ASSERT(partial_result.ec == std::errc::invalid_argument);
-                return partial_result;
-            }
+inline constexpr auto u64_pow10_table = []() consteval {
+    std::array<std::uint64_t, 20> result {};
+    for (std::size_t i = 0; i < result.size(); ++i) {
+        result[i] = u64_pow_naive(10, int(i));
+    }
+    return result;
+}();
 
-            const int added_digits = 64 - std::countl_zero(digits);
-            if (shift + added_digits > 128) {
-                return { initial_last, std::errc::result_out_of_range };
-            }
+[[nodiscard]]
+constexpr bool is_pow_2(const int base)
+{
+    return (base & (base - 1)) == 0;
+}
 
-            result |= uint128_t(digits) << shift;
-            shift += bits_per_iteration;
+// The functions with a `FixedBase` template parameter select the kernel for the base
+// with `if constexpr` if it is not zero, in which case `base` has to be equal to it.
+// Otherwise, the kernel is selected at run time.
 
-            if (current_last - first <= max_lower_length || partial_result.ec != std::errc {}) {
-                out = result;
-                return { initial_last, partial_result.ec };
-            }
-            current_last -= lower_length;
-            CHARCONV_EXT_ASSERT(current_last >= first);
-        }
-    }
-    else {
-        uint128_t factor = 1;
+/// @brief `true` if the decimal kernels have to be compiled for `FixedBase`.
+template <int FixedBase>
+inline constexpr bool may_be_decimal = FixedBase == 0 || FixedBase == 10;
 
-        while (true) {
-            const auto lower_length = std::min(current_last - first, max_lower_length);
-            const char* const current_first = current_last - lower_length;
+/// @brief `true` if the kernels for powers of two have to be compiled for `FixedBase`.
+template <int FixedBase>
+inline constexpr bool may_be_pow_2 = FixedBase == 0 || is_pow_2(FixedBase);
 
-            std::uint64_t digits {};
-            const std::from_chars_result partial_result
-                = std::from_chars(current_first, current_last, digits, base);
+/// @brief `true` if the kernels for other bases have to be compiled for `FixedBase`.
+template <int FixedBase>
+inline constexpr bool may_be_other_base
+    = FixedBase == 0 || (FixedBase != 10 && !is_pow_2(FixedBase));
 
-            uint128_t summand;
-            if (detail::mul_overflow(summand, factor, digits)) {
-                return { initial_last, std::errc::result_out_of_range };
-            }
-            if (detail::add_overflow(result, result, summand)) {
-                return { initial_last, std::errc::result_out_of_range };
-            }
+/// @brief Returns the amount of digits in `x` when printed in the given base,
+/// which is at least `1`.
+template <int FixedBase = 0>
+[[nodiscard]]
+constexpr int u64_digit_count(const std::uint64_t x, const int base)
+{
+    CHARCONV_EXT_ASSERT(base >= 2);
+    CHARCONV_EXT_ASSERT(base <= 36);
+    CHARCONV_EXT_ASSERT(FixedBase == 0 || base == FixedBase);
 
-            if (current_last - first <= max_lower_length || partial_result.ec != std::errc {}) {
-                out = result;
-                return { initial_last, partial_result.ec };
-            }
-            factor *= max_pow;
-            current_last -= lower_length;
-            CHARCONV_EXT_ASSERT(current_last >= first);
+    const int bit_width = std::bit_width(x | 1);
+    if constexpr (may_be_decimal<FixedBase>) {
+        if (FixedBase == 10 || base == 10) {
+            // 1233 / 4096 is a close upper approximation of log10(2).
+            const int log10_guess = (bit_width * 1233) >> 12;
+            return log10_guess + int((x | 1) >= u64_pow10_table[std::size_t(log10_guess)]);
+        }
+    }
+    if constexpr (may_be_pow_2<FixedBase>) {
+        if (FixedBase != 0 || is_pow_2(base)) {
+            const int bits_per_digit = std::countr_zero(unsigned(base));
+            return (bit_width + bits_per_digit - 1) / bits_per_digit;
+        }
+    }
+    const int max_digits = u64_max_representable_digits(base);
+    std::uint64_t power = std::uint64_t(base);
+    for (int result = 1; result < max_digits; ++result, power *= std::uint64_t(base)) {
+        if (x < power) {
+            return result;
         }
     }
+    return max_digits + int(x >= power);
 }
 
-constexpr std::from_chars_result
-from_chars(const char* const first, const char* const last, int128_t& out, const int base = 10)
+/// @brief Writes the eight decimal digits of `x`, including leading zeros, to `out`.
+/// `x` is turned into a fixed-point fraction `x / pow(10, 6)` with 57 fractional bits,
+/// and every multiplication by 100 moves the next pair of digits into the integer part.
+/// Unlike repeated division, the pairs do not depend on each other's quotients.
+constexpr void write_8_decimal_digits(char* const out, const std::uint32_t x)
 {
-    CHARCONV_EXT_ASSERT(first);
-    CHARCONV_EXT_ASSERT(last);
+    CHARCONV_EXT_ASSERT(x < 100'000'000);
 
-    if (first == last) {
-        return { last, std::errc::invalid_argument };
-    }
+    constexpr int fraction_bits = 57;
+    constexpr std::uint64_t fraction_mask = (std::uint64_t(1) << fraction_bits) - 1;
+    std::uint64_t t = std::uint64_t(x) * ((std::uint64_t(1) << fraction_bits) / 1'000'000 + 1);
 
-    if (*first != '-') {
-        uint128_t x {};
-        const std::from_chars_result result = from_chars(first, last, x, base);
-        if (x >> 127) {
-            return { result.ptr, std::errc::result_out_of_range };
-        }
-        out = int128_t(x);
-        return result;
-    }
-    const std::ptrdiff_t max_lower_length = detail::u64_max_representable_digits(base);
-    if (last - first + 1 <= max_lower_length) {
-        std::int64_t x {};
-        const std::from_chars_result result = std::from_chars(first, last, x, base);
-        out = x;
-        return result;
-    }
-    constexpr auto max_u128 = uint128_t { 1 } << 127;
-    uint128_t x {};
-    const std::from_chars_result result = from_chars(first + 1, last, x, base);
-    if (x > max_u128) {
-        return { result.ptr, std::errc::result_out_of_range };
+    for (int i = 0; i < 8; i += 2) {
+        const std::size_t pair = std::size_t(t >> fraction_bits);
+        out[i] = decimal_digit_pairs[2 * pair];
+        out[i + 1] = decimal_digit_pairs[2 * pair + 1];
+        t = (t & fraction_mask) * 100;
     }
-    out = int128_t(-x);
-    return result;
 }
 
-constexpr std::to_chars_result
-to_chars(char* const first, char* const last, const uint128_t x, const int base = 10)
+/// @brief Writes exactly `length` digits of `x` in the given base to `out`,
+/// with leading zeros if `x` has fewer digits than that.
+/// If `x` has more digits, only the least significant `length` digits are written.
+template <int FixedBase = 0>
+constexpr void write_u64_digits(char* const out, std::uint64_t x, int length, const int base)
 {
-    CHARCONV_EXT_ASSERT(first);
-    CHARCONV_EXT_ASSERT(last);
     CHARCONV_EXT_ASSERT(base >= 2);
     CHARCONV_EXT_ASSERT(base <= 36);
+    CHARCONV_EXT_ASSERT(FixedBase == 0 || base == FixedBase);
+    CHARCONV_EXT_ASSERT(length >= 0);
 
-    if (x <= std::uint64_t(-1)) {
-        return std::to_chars(first, last, std::uint64_t(x), base);
-    }
-    if (first == last) {
-        return { last, std::errc::value_too_large };
-    }
-
-    const std::uint64_t max_pow = detail::u64_max_power(base);
-    const bool is_pow_2 = (base & (base - 1)) == 0;
-    const int piece_max_digits = detail::u64_max_representable_digits(base);
-
-    if (is_pow_2) {
-        const int bits_per_iteration = std::countr_zero(max_pow);
-        CHARCONV_EXT_ASSERT(bits_per_iteration != 0);
-        const int leading_bits = 128 % bits_per_iteration;
-
-        char* current_first = first;
-        bool first_digit = true;
-
-        // First, we need to take care of the leading "head" bits.
-        // For example, for octal, we operate on 63 bits at a time,
-        // and 2 leading bits are left over.
-        if (leading_bits != 0) {
-            const auto head_mask = (std::uint64_t(1) << leading_bits) - 1;
-            const auto head = std::uint64_t(x >> (128 - leading_bits)) & head_mask;
-            if (head != 0) {
-                first_digit = false;
-                const std::to_chars_result head_result = std::to_chars(first, last, head, base);
-                if (head_result.ec != std::errc {}) {
-                    return head_result;
-                }
-                current_first = head_result.ptr;
-            }
-        }
-
-        int shift = 128 - leading_bits - bits_per_iteration;
-        CHARCONV_EXT_ASSERT(bits_per_iteration <= 64);
-        const auto mask = //
-            (bits_per_iteration == 64 ? std::uint64_t(0) : (std::uint64_t(1) << bits_per_iteration))
-            - 1;
-
-        // Once the head digits are printed out, every subsequent block of bits
-        // has exactly the same amount of digits.
-        // For example, for octal, there are 126 bits left,
-        // handled exactly 63 bits at a time.
-        while (true) {
-            const auto piece = std::uint64_t(x >> shift) & mask;
-            const std::to_chars_result piece_result
-                = std::to_chars(current_first, last, piece, base);
-            if (piece_result.ec != std::errc {}) {
-                return piece_result;
-            }
-            const auto zero_pad = piece_max_digits - int(piece_result.ptr - current_first);
-            if (!first_digit && zero_pad != 0) {
-                std::ranges::copy(current_first, piece_result.ptr, current_first + zero_pad);
-                std::ranges::fill_n(current_first, zero_pad, '0');
-                current_first += piece_max_digits;
+    char* p = out + length;
+    if constexpr (may_be_decimal<FixedBase>) {
+        if (FixedBase == 10 || base == 10) {
+            for (; length >= 8; length -= 8, p -= 8) {
+                write_8_decimal_digits(p - 8, std::uint32_t(x % 100'000'000));
+                x /= 100'000'000;
             }
-            else {
-                current_first = piece_result.ptr;
+            for (; length >= 2; length -= 2) {
+                const std::size_t pair = std::size_t(x % 100);
+                x /= 100;
+                *--p = decimal_digit_pairs[2 * pair + 1];
+                *--p = decimal_digit_pairs[2 * pair];
             }
-
-            if (shift <= 0) {
-                CHARCONV_EXT_ASSERT(shift == 0);
-                return { current_first, std::errc {} };
+            if (length != 0) {
+                *--p = char('0' + x % 10);
             }
-            shift -= bits_per_iteration;
-            first_digit = false;
+            return;
         }
     }
-    // NOLINTNEXTLINE(readability-else-after-return)
-    else {
-        const std::to_chars_result upper_result = to_chars(first, last, x / max_pow, base);
-        if (upper_result.ec != std::errc {}) {
-            return upper_result;
+    if constexpr (may_be_pow_2<FixedBase>) {
+        if (FixedBase != 0 || is_pow_2(base)) {
+            const int bits_per_digit = std::countr_zero(unsigned(base));
+            const std::uint64_t mask = std::uint64_t(base) - 1;
+            for (; length != 0; --length, x >>= bits_per_digit) {
+                *--p = digit_chars[x & mask];
+            }
+            return;
         }
-
-        const std::to_chars_result lower_result
-            = std::to_chars(upper_result.ptr, last, std::uint64_t(x % max_pow), base);
-        if (lower_result.ec != std::errc {}) {
-            return lower_result;
+    }
+    if constexpr (may_be_other_base<FixedBase>) {
+        for (; length != 0; --length, x /= std::uint64_t(base)) {
+            *--p = digit_chars[x % std::uint64_t(base)];
         }
-        const auto lower_length = lower_result.ptr - upper_result.ptr;
+    }
+}
 
-        // The remainder (lower part) is mathematically exactly 19 digits long,
-        // and we have to zero-pad to the left if it is shorter
-        // (because std::to_chars wouldn't give us the leading zeros we need).
-        char* const result_end = upper_result.ptr + piece_max_digits;
-        std::ranges::copy(
-            upper_result.ptr, upper_result.ptr + lower_length, result_end - lower_length
-        );
-        std::ranges::fill_n(upper_result.ptr, piece_max_digits - lower_length, '0');
+/// @brief Loads eight characters into an integer such that `p[0]` is the least significant
+/// byte, regardless of the byte order of the target.
+[[nodiscard]]
+constexpr std::uint64_t load_u64_le(const char* const p)
+{
+    std::uint64_t result = 0;
+    for (int i = 0; i < 8; ++i) {
+        result |= std::uint64_t(static_cast<unsigned char>(p[i])) << (8 * i);
+    }
+    return result;
+}
 
-        return { result_end, std::errc {} };
+[[nodiscard]]
+constexpr std::uint64_t load_u64_le(const std::byte* const p)
+{
+    std::uint64_t result = 0;
+    for (int i = 0; i < 8; ++i) {
+        result |= std::uint64_t(p[i]) << (8 * i);
     }
-    CHARCONV_EXT_UNREACHABLE();
+    return result;
 }
 
-constexpr std::to_chars_result
-to_chars(char* const first, char* const last, const int128_t x, const int base = 10)
+/// @brief Returns the value of eight decimal digit values, one per byte,
+/// with the most significant digit in the least significant byte.
+/// Neighboring digits, pairs, and quadruples are combined in three multiplications,
+/// using SWAR (SIMD within a register).
+[[nodiscard]]
+constexpr std::uint32_t combine_8_decimal_digits(std::uint64_t x)
+{
+    x = ((x * 10) + (x >> 8)) & 0x00FF00FF00FF00FF;
+    x = ((x * 100) + (x >> 16)) & 0x0000FFFF0000FFFF;
+    x = ((x * 10000) + (x >> 32)) & 0x00000000FFFFFFFF;
+    return std::uint32_t(x);
+}
+
+/// @brief Parses eight decimal digits at once, using `combine_8_decimal_digits`.
+[[nodiscard]]
+constexpr std::uint32_t parse_8_decimal_digits(const char* const p)
+{
+    return combine_8_decimal_digits(load_u64_le(p) - 0x3030303030303030);
+}
+
+/// @brief Parses exactly `length` digits in the given base, starting at `p`.
+/// The digits have to be validated by the caller (e.g. with `pattern_length`),
+/// and must represent a value which fits into `std::uint64_t`.
+template <int FixedBase = 0>
+[[nodiscard]]
+constexpr std::uint64_t parse_u64_digits(const char* p, int length, const int base)
 {
-    CHARCONV_EXT_ASSERT(first);
-    CHARCONV_EXT_ASSERT(last);
     CHARCONV_EXT_ASSERT(base >= 2);
     CHARCONV_EXT_ASSERT(base <= 36);
+    CHARCONV_EXT_ASSERT(FixedBase == 0 || base == FixedBase);
+    CHARCONV_EXT_ASSERT(length >= 0);
 
-    if (x >= 0) {
-        return to_chars(first, last, uint128_t(x), base);
+    std::uint64_t result = 0;
+    if constexpr (may_be_decimal<FixedBase>) {
+        if (FixedBase == 10 || base == 10) {
+            for (; length >= 8; length -= 8, p += 8) {
+                result = result * 100'000'000 + parse_8_decimal_digits(p);
+            }
+            for (; length != 0; --length, ++p) {
+                result = result * 10 + std::uint64_t(*p - '0');
+            }
+            return result;
+        }
+    }
+    if constexpr (may_be_pow_2<FixedBase>) {
+        if (FixedBase != 0 || is_pow_2(base)) {
+            const int bits_per_digit = std::countr_zero(unsigned(base));
+            for (; length != 0; --length, ++p) {
+                result = (result << bits_per_digit) | std::uint64_t(digit_value(*p));
+            }
+            return result;
+        }
     }
-    if (x == std::int64_t(x)) {
-        return std::to_chars(first, last, std::int64_t(x), base);
+    if constexpr (may_be_other_base<FixedBase>) {
+        for (; length != 0; --length, ++p) {
+            result = result * std::uint64_t(base) + std::uint64_t(digit_value(*p));
+        }
     }
-    if (last - first < 2) {
+    return result;
+}
+
+/// @brief Implements the interface of `std::to_chars` for `std::uint64_t`,
+/// based on `u64_digit_count` and `write_u64_digits`.
+constexpr std::to_chars_result
+to_chars_u64(char* const first, char* const last, const std::uint64_t x, const int base)
+{
+    const int length = u64_digit_count(x, base);
+    if (last - first < length) {
         return { last, std::errc::value_too_large };
     }
-    *first = '-';
-    return to_chars(first + 1, last, -uint128_t(x), base);
+    write_u64_digits(first, x, length, base);
+    return { first + length, std::errc {} };
 }
 
-#endif
+#ifdef CHARCONV_EXT_SSE2
+/// @brief Returns the sixteen characters `'0'` and `'1'` for the bits of `bits`,
+/// most significant bit first.
+/// The high and the low byte are broadcast to one half of the vector each,
+/// and every byte is compared against a mask which selects the bit for its position.
+[[nodiscard]]
+inline __m128i expand_16_bits_sse2(const std::uint32_t bits)
+{
+    constexpr std::uint64_t broadcast = 0x0101010101010101;
+    const __m128i bytes = _mm_set_epi64x(
+        std::int64_t((bits & 0xff) * broadcast), std::int64_t((bits >> 8 & 0xff) * broadcast)
+    );
+    const __m128i bit_masks = _mm_set1_epi64x(0x0102040810204080);
+    const __m128i set = _mm_cmpeq_epi8(_mm_and_si128(bytes, bit_masks), bit_masks);
+    // set is -1 for every '1' digit, so subtracting it from '0' yields '1'.
+    return _mm_sub_epi8(_mm_set1_epi8('0'), set);
+}
 
-#ifdef CHARCONV_EXT_BITINT_MAXWIDTH
-#ifdef __clang__
-#pragma clang diagnostic push
-#pragma clang diagnostic ignored "-Wbit-int-extension"
+/// @brief Returns the sixteen bits for the characters `'0'` and `'1'` in `chars`,
+/// with the first character as the most significant bit.
+/// The bytes are reversed, and the lowest bit of every character is moved
+/// into the sign bit of its byte, so that `pmovmskb` extracts all sixteen bits.
+[[nodiscard]]
+inline std::uint32_t collect_16_bits_sse2(__m128i chars)
+{
+    chars = _mm_shuffle_epi32(chars, _MM_SHUFFLE(0, 1, 2, 3));
+    chars = _mm_shufflelo_epi16(chars, _MM_SHUFFLE(2, 3, 0, 1));
+    chars = _mm_shufflehi_epi16(chars, _MM_SHUFFLE(2, 3, 0, 1));
+    chars = _mm_or_si128(_mm_slli_epi16(chars, 8), _mm_srli_epi16(chars, 8));
+    return std::uint32_t(_mm_movemask_epi8(_mm_slli_epi16(chars, 7)));
+}
+
+/// @brief Returns a mask with bit `i` set if `chars[i]` is a binary digit.
+[[nodiscard]]
+inline unsigned binary_digit_mask_sse2(const __m128i chars)
+{
+    // '0' | 1 and '1' | 1 are both '1', and no other character becomes '1'.
+    const __m128i ones = _mm_set1_epi8('1');
+    return unsigned(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_or_si128(chars, _mm_set1_epi8(1)), ones)));
+}
 #endif
 
-template <std::size_t N>
-using bit_int = _BitInt(N);
-template <std::size_t N>
-using bit_uint = unsigned _BitInt(N);
+} // namespace detail
 
-#ifdef __clang__
-#pragma clang diagnostic pop
-#endif
+/// @brief The result of `divider::divmod`.
+template <typename T>
+struct divmod_result {
+    uint128_t quotient;
+    T remainder;
+};
 
-namespace detail {
+/// @brief Divides 128-bit unsigned integers by a divisor of type `T`
+/// which is only known at run time, but used many times.
+/// The constructor precomputes a reciprocal of the divisor,
+/// so that every division only takes a few multiplications, and no division instruction
+/// or call to `__udivti3`.
+/// Specializations exist for `std::uint64_t` and `uint128_t`.
+template <typename T>
+class divider;
 
-template <std::size_t N>
-consteval auto int_least()
-{
-    if constexpr (N <= 8) {
-        return std::int_least8_t {};
+/// @brief Divides 128-bit unsigned integers by a 64-bit divisor.
+///
+/// The divisor is normalized by shifting it left until its most significant bit is set,
+/// and the dividend is shifted by the same amount.
+/// The quotient is then computed 64 bits at a time by the "2/1 division" of
+/// N. Möller and T. Granlund, "Improved division by invariant integers" (2011),
+/// which uses the reciprocal `floor((pow(2, 128) - 1) / d) - pow(2, 64)`.
+template <>
+class divider<std::uint64_t> {
+public:
+    constexpr explicit divider(const std::uint64_t d) noexcept
+        : m_divisor(d)
+        , m_shift(std::countl_zero(d))
+        , m_normalized(d << (m_shift & 63))
+        , m_reciprocal(std::uint64_t(uint128_t(-1) / m_normalized))
+    {
+        CHARCONV_EXT_ASSERT(d != 0);
     }
-    else if constexpr (N <= 16) {
-        return std::int_least16_t {};
+
+    [[nodiscard]]
+    constexpr std::uint64_t divisor() const noexcept
+    {
+        return m_divisor;
     }
-    else if constexpr (N <= 32) {
-        return std::int_least32_t {};
+
+    [[nodiscard]]
+    constexpr divmod_result<std::uint64_t> divmod(const uint128_t x) const noexcept
+    {
+        // x << m_shift has up to 192 bits, split into three words.
+        const uint128_t hi = uint128_t(std::uint64_t(x >> 64)) << m_shift;
+        const uint128_t lo = uint128_t(std::uint64_t(x)) << m_shift;
+        const auto top = std::uint64_t(hi >> 64);
+        const auto middle = std::uint64_t(hi) | std::uint64_t(lo >> 64);
+
+        const auto [quotient_hi, remainder_hi] = divide_2_by_1(top, middle);
+        const auto [quotient_lo, remainder] = divide_2_by_1(remainder_hi, std::uint64_t(lo));
+        return { (uint128_t(quotient_hi) << 64) | quotient_lo, remainder >> m_shift };
     }
-    else if constexpr (N <= 64) {
-        return std::int_least64_t {};
+
+    [[nodiscard]]
+    friend constexpr uint128_t operator/(const uint128_t x, const divider& d) noexcept
+    {
+        return d.divmod(x).quotient;
     }
-    else if constexpr (N <= 128) {
-        return int128_t {};
+
+    [[nodiscard]]
+    friend constexpr std::uint64_t operator%(const uint128_t x, const divider& d) noexcept
+    {
+        return d.divmod(x).remainder;
     }
-}
 
-template <std::size_t N>
-consteval auto uint_least()
-{
-    if constexpr (N <= 8) {
-        return std::uint_least8_t {};
+private:
+    std::uint64_t m_divisor;
+    int m_shift;
+    std::uint64_t m_normalized;
+    std::uint64_t m_reciprocal;
+
+    /// @brief Divides `u1 * pow(2, 64) + u0` by the normalized divisor, where `u1` must be less
+    /// than the normalized divisor, and returns the quotient and the remainder.
+    [[nodiscard]]
+    constexpr divmod_result<std::uint64_t>
+    divide_2_by_1(const std::uint64_t u1, const std::uint64_t u0) const noexcept
+    {
+        const uint128_t estimate
+            = uint128_t(m_reciprocal) * u1 + ((uint128_t(u1 + 1) << 64) | u0);
+        auto quotient = std::uint64_t(estimate >> 64);
+        std::uint64_t remainder = u0 - quotient * m_normalized;
+        // The estimate is at most one too large or too small.
+        // The first correction is frequent and unpredictable, so it is done without a branch.
+        const std::uint64_t too_large = -std::uint64_t(remainder > std::uint64_t(estimate));
+        quotient += too_large;
+        remainder += too_large & m_normalized;
+        if (remainder >= m_normalized) [[unlikely]] {
+            ++quotient;
+            remainder -= m_normalized;
+        }
+        return { quotient, remainder };
     }
-    else if constexpr (N <= 16) {
-        return std::uint_least16_t {};
+};
+
+/// @brief Divides 128-bit unsigned integers by a 128-bit divisor.
+///
+/// Divisors which fit into 64 bits use `divider<std::uint64_t>`,
+/// and powers of two a shift.
+/// Any other divisor `d`, with `l = floor(log2(d))`, uses a multiplication
+/// with a 129-bit magic number `m` such that `x / d == floor(x * m / pow(2, 128 + l))`,
+/// in the same way as libdivide.
+/// Since the most significant bit of `m` is not stored, it is added back
+/// with an extra addition and shift if necessary.
+template <>
+class divider<uint128_t> {
+public:
+    constexpr explicit divider(const uint128_t d) noexcept
+        : m_divisor(d)
+        , m_small(std::uint64_t(d <= std::uint64_t(-1) ? d : 1))
+    {
+        CHARCONV_EXT_ASSERT(d != 0);
+        if (d <= std::uint64_t(-1)) {
+            return;
+        }
+        const auto hi = std::uint64_t(d >> 64);
+        m_shift = 127 - std::countl_zero(hi);
+        if ((d & (d - 1)) == 0) {
+            return;
+        }
+
+        // Long division of pow(2, 128 + m_shift) by d, where pow(2, m_shift) < d.
+        uint128_t quotient = 0;
+        uint128_t remainder = uint128_t { 1 } << m_shift;
+        for (int i = 0; i < 128; ++i) {
+            const bool carry = (remainder >> 127) != 0;
+            remainder <<= 1;
+            quotient <<= 1;
+            if (carry || remainder >= d) {
+                remainder -= d;
+                quotient |= 1;
+            }
+        }
+
+        // If pow(2, m_shift) is enough to compensate for the error of the magic number,
+        // the magic number fits into 128 bits, otherwise, we need one more bit.
+        if (d - remainder >= (uint128_t { 1 } << m_shift)) {
+            const uint128_t twice_remainder = remainder + remainder;
+            quotient += quotient;
+            quotient += twice_remainder >= d || twice_remainder < remainder;
+            m_add = true;
+        }
+        m_magic = quotient + 1;
     }
-    else if constexpr (N <= 32) {
-        return std::uint_least32_t {};
+
+    [[nodiscard]]
+    constexpr uint128_t divisor() const noexcept
+    {
+        return m_divisor;
     }
-    else if constexpr (N <= 64) {
-        return std::uint_least64_t {};
+
+    [[nodiscard]]
+    constexpr divmod_result<uint128_t> divmod(const uint128_t x) const noexcept
+    {
+        if (m_divisor <= std::uint64_t(-1)) {
+            const auto [quotient, remainder] = m_small.divmod(x);
+            return { quotient, remainder };
+        }
+        uint128_t quotient;
+        if (m_magic == 0) {
+            quotient = x >> m_shift;
+        }
+        else {
+            quotient = magic_quotient(x);
+        }
+        return { quotient, x - quotient * m_divisor };
     }
-    else if constexpr (N <= 128) {
-        return uint128_t {};
+
+    [[nodiscard]]
+    friend constexpr uint128_t operator/(const uint128_t x, const divider& d) noexcept
+    {
+        return d.divmod(x).quotient;
     }
-}
 
-template <std::size_t N>
-using int_leastN_t = decltype(int_least<N>());
+    [[nodiscard]]
+    friend constexpr uint128_t operator%(const uint128_t x, const divider& d) noexcept
+    {
+        return d.divmod(x).remainder;
+    }
 
-template <std::size_t N>
-using uint_leastN_t = decltype(uint_least<N>());
+private:
+    uint128_t m_divisor;
+    divider<std::uint64_t> m_small;
+    uint128_t m_magic = 0;
+    int m_shift = 0;
+    bool m_add = false;
+
+    [[nodiscard]]
+    constexpr uint128_t magic_quotient(const uint128_t x) const noexcept
+    {
+        const uint128_t hi = detail::umul128_hi(m_magic, x);
+        if (m_add) {
+            // (x + hi) / 2 without overflow, which accounts for the implicit bit of the magic
+            return (((x - hi) >> 1) + hi) >> m_shift;
+        }
+        return hi >> m_shift;
+    }
+};
+
+namespace detail {
+
+/// @brief `divider`s for `u64_max_power(base)`,
+/// where powers which do not fit into `std::uint64_t` are replaced by `1`.
+inline constexpr auto u64_max_power_dividers = []<std::size_t... I>(std::index_sequence<I...>) {
+    constexpr auto divisor = [](const std::uint64_t power) { return power == 0 ? 1 : power; };
+    return std::array { divider<std::uint64_t>(divisor(u64_max_power_table[I]))... };
+}(std::make_index_sequence<u64_max_power_table.size()> {});
+
+/// @brief `divider`s for every power of ten which fits into `uint128_t`.
+inline constexpr auto u128_pow10_dividers = []<std::size_t... I>(std::index_sequence<I...>) {
+    uint128_t power = 1;
+    const auto next = [&power] { return std::exchange(power, power * 10); };
+    return std::array { (void(I), divider<uint128_t>(next()))... };
+}(std::make_index_sequence<39> {});
 
 } // namespace detail
 
-template <std::size_t N>
-constexpr std::to_chars_result to_chars(
-    char* const first, //
-    char* const last,
-    const bit_int<N> x,
-    const int base = 10
-)
-{
-    using std::to_chars;
-    static_assert(N <= 128, "Sorry, to_chars for _BitInt(129) and wider not implemented :(");
-    return to_chars(first, last, detail::int_leastN_t<N> { x }, base);
-}
+/// @brief The implementations of the 128-bit conversions which `basic_converter` can select.
+///
+/// - `automatic` is used by the free functions: SSE2 kernels if the target has SSE2,
+///   AVX-512 kernels if the CPU supports them at run time, and `swar` otherwise.
+/// - `scalar` converts one digit per multiplication or division.
+/// - `swar` converts eight decimal digits at a time with SWAR (SIMD within a register),
+///   but doesn't use any SIMD instructions.
+/// - `sse` additionally uses SSE2 kernels.
+/// - `avx2` is currently identical to `sse`, because there are no AVX2 kernels.
+/// - `avx512` additionally uses AVX-512 kernels without checking for CPU support.
+/// - `constant_time` takes time which depends only on the base and on the length of the text,
+///   but not on the value of the digits, and makes no data-dependent table lookups.
+enum class backend { automatic, scalar, swar, sse, avx2, avx512, constant_time };
 
-template <std::size_t N>
-constexpr std::to_chars_result to_chars(
-    char* const first, //
-    char* const last,
-    const bit_uint<N> x,
-    const int base = 10
-)
+namespace detail {
+
+#ifdef CHARCONV_EXT_SSE2
+/// @brief Implements the interface of `to_chars` for base-2 output of 128-bit integers,
+/// writing sixteen digits per store.
+/// The digits are written backwards from the end in blocks of sixteen,
+/// and the most significant block is written so that it starts at `first`,
+/// possibly overlapping the block after it with identical contents.
+inline std::to_chars_result
+to_chars_u128_binary_sse2(char* const first, char* const last, const uint128_t x)
 {
-    using std::to_chars;
-    static_assert(N <= 128, "Sorry, to_chars for _BitInt(129) and wider not implemented :(");
-    return to_chars(first, last, detail::uint_leastN_t<N> { x }, base);
+    const auto hi = std::uint64_t(x >> 64);
+    const int length = hi != 0 ? 128 - std::countl_zero(hi) : std::bit_width(std::uint64_t(x) | 1);
+    if (last - first < length) {
+        return { last, std::errc::value_too_large };
+    }
+    if (length < 16) {
+        write_u64_digits(first, std::uint64_t(x), length, 2);
+        return { first + length, std::errc {} };
+    }
+
+    char* const digits_last = first + length;
+    char* current = digits_last;
+    for (uint128_t rest = x; current - first >= 16; current -= 16, rest >>= 16) {
+        const __m128i chars = expand_16_bits_sse2(std::uint32_t(rest & 0xffff));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(current - 16), chars);
+    }
+    if (current != first) {
+        const auto leading = std::uint32_t(x >> (length - 16) & 0xffff);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(first), expand_16_bits_sse2(leading));
+    }
+    return { digits_last, std::errc {} };
 }
 
-template <std::size_t N>
-constexpr std::from_chars_result from_chars(
+/// @brief Implements `from_chars_magnitude` for base 2, reading sixteen digits at once.
+/// Every block of sixteen characters is validated with one comparison,
+/// and its bits are extracted with `collect_16_bits_sse2`.
+inline std::from_chars_result from_chars_binary_sse2(
     const char* const first, //
     const char* const last,
-    bit_int<N>& x,
-    const int base = 10
+    uint128_t& out,
+    const uint128_t limit
 )
 {
-    using std::from_chars;
-    static_assert(N <= 128, "Sorry, from_chars for _BitInt(129) and wider not implemented :(");
-    detail::int_leastN_t<N> value {};
-    auto result = from_chars(first, last, value, base);
-    x = static_cast<bit_int<N>>(value);
-    if (result.ec == std::errc {} && x != value) {
-        // This detects the case where parsing succeeded,
-        // but the result is not exactly representable as a bit-precise integer.
-        result.ec = std::errc::result_out_of_range;
-    }
+    uint128_t result = 0;
+    bool overflow = false;
+    const char* current = first;
+
+    while (last - current >= 16) {
+        const __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(current));
+        const unsigned digit_mask = binary_digit_mask_sse2(chars);
+        const std::uint32_t bits = collect_16_bits_sse2(chars);
+
+        if (digit_mask != 0xffff) {
+            const int digits = std::countr_zero(~digit_mask);
+            if (digits != 0) {
+                overflow |= (result >> (128 - digits)) != 0;
+                result = (result << digits) | (bits >> (16 - digits));
+            }
+            current += digits;
+            break;
+        }
+        overflow |= (result >> 112) != 0;
+        result = (result << 16) | bits;
+        current += 16;
+    }
+    for (; current != last && (*current == '0' || *current == '1'); ++current) {
+        overflow |= (result >> 127) != 0;
+        result = (result << 1) | uint128_t(*current - '0');
+    }
+
+    if (current == first) {
+        return { first, std::errc::invalid_argument };
+    }
+    if (current - first > 64) {
+        CHARCONV_EXT_PROBE(from_chars_chunks, current - first, 2);
+    }
+    if (overflow || result > limit) {
+        CHARCONV_EXT_PROBE(out_of_range, current - first, 2);
+        return { current, std::errc::result_out_of_range };
+    }
+    out = result;
+    return { current, std::errc {} };
+}
+#endif
+
+#ifdef CHARCONV_EXT_X86_DISPATCH
+/// @brief Returns `ceil(pow(2, exponent) / d)`.
+[[nodiscard]]
+consteval uint128_t ceil_div_pow_2(const int exponent, const std::uint64_t d)
+{
+    uint128_t quotient = 0;
+    std::uint64_t remainder = 0;
+    for (int i = exponent; i >= 0; --i) {
+        remainder = 2 * remainder + std::uint64_t(i == exponent);
+        quotient = 2 * quotient + std::uint64_t(remainder >= d);
+        remainder -= remainder >= d ? d : 0;
+    }
+    return quotient + std::uint64_t(remainder != 0);
+}
+
+/// @brief Returns `x / pow(10, 16)` for any `x` with at most 128 bits,
+/// using a multiplication with the reciprocal instead of a 128-bit division.
+/// Since `pow(10, 16) == pow(2, 16) * pow(5, 16)`, we divide `x >> 16` (which has at most 112 bits)
+/// by `pow(5, 16)`, which has 38 bits, so the reciprocal fits into 113 bits.
+[[nodiscard]]
+constexpr uint128_t div_pow10_16(const uint128_t x)
+{
+    constexpr std::uint64_t divisor = u64_pow_naive(5, 16);
+    constexpr uint128_t reciprocal = ceil_div_pow_2(112 + 38, divisor);
+    return umul128_hi(x >> 16, reciprocal) >> (112 + 38 - 128);
+}
+
+[[nodiscard]]
+inline bool has_avx512vbmi()
+{
+#if defined(__AVX512VBMI__) && defined(__AVX512DQ__) && defined(__AVX512BW__)
+    return true;
+#else
+    return __builtin_cpu_supports("avx512vbmi") && __builtin_cpu_supports("avx512dq")
+        && __builtin_cpu_supports("avx512bw");
+#endif
+}
+
+/// @brief Implements the interface of `to_chars` for decimal output of 128-bit integers
+/// which are greater than `std::uint64_t(-1)`, using AVX-512 VBMI.
+///
+/// `x` is split into five groups of eight decimal digits.
+/// Every group is broadcast to eight 64-bit lanes, where lane `j` computes digit `j`
+/// as the integer part of `10 * fract(group / pow(10, 8 - j))`, in fixed-point arithmetic
+/// with 56 fractional bits, so every digit ends up in the most significant byte of its lane.
+/// A single `vpermb` per group gathers these bytes into place.
+/// Finally, leading zeros are trimmed by another `vpermb`,
+/// and the result is written with one masked store.
+[[gnu::target("avx512f,avx512bw,avx512dq,avx512vbmi")]]
+inline std::to_chars_result
+to_chars_u128_decimal_avx512(char* const first, char* const last, const uint128_t x)
+{
+    constexpr std::uint64_t pow10_8 = 100'000'000;
+    constexpr std::uint64_t pow10_16 = pow10_8 * pow10_8;
+
+    const uint128_t upper = div_pow10_16(x);
+    const auto lower = std::uint64_t(x - upper * pow10_16);
+    const auto top = std::uint64_t(div_pow10_16(upper));
+    const auto middle = std::uint64_t(upper - uint128_t(top) * pow10_16);
+    const std::uint64_t groups[5]
+        = { top, middle / pow10_8, middle % pow10_8, lower / pow10_8, lower % pow10_8 };
+
+    // vpmullq is slow on many microarchitectures, so the 64-bit products are assembled
+    // from two 32x32-bit multiplications instead, which is possible because groups have 27 bits.
+    constexpr int fraction_bits = 56;
+    constexpr auto reciprocal = [](const std::uint64_t power) consteval {
+        return std::uint64_t(ceil_div_pow_2(fraction_bits, power));
+    };
+    const __m512i reciprocals_lo = _mm512_set_epi64(
+        std::int64_t(reciprocal(10) & 0xffff'ffff),
+        std::int64_t(reciprocal(100) & 0xffff'ffff),
+        std::int64_t(reciprocal(1000) & 0xffff'ffff),
+        std::int64_t(reciprocal(10000) & 0xffff'ffff),
+        std::int64_t(reciprocal(100000) & 0xffff'ffff),
+        std::int64_t(reciprocal(1000000) & 0xffff'ffff),
+        std::int64_t(reciprocal(10000000) & 0xffff'ffff),
+        std::int64_t(reciprocal(100000000) & 0xffff'ffff)
+    );
+    const __m512i reciprocals_hi = _mm512_set_epi64(
+        std::int64_t(reciprocal(10) >> 32),
+        std::int64_t(reciprocal(100) >> 32),
+        std::int64_t(reciprocal(1000) >> 32),
+        std::int64_t(reciprocal(10000) >> 32),
+        std::int64_t(reciprocal(100000) >> 32),
+        std::int64_t(reciprocal(1000000) >> 32),
+        std::int64_t(reciprocal(10000000) >> 32),
+        std::int64_t(reciprocal(100000000) >> 32)
+    );
+    const __m512i fraction_mask = _mm512_set1_epi64((std::int64_t(1) << fraction_bits) - 1);
+    const __m512i byte_iota = _mm512_set_epi8(
+        63, 62, 61, 60, 59, 58, 57, 56, 55, 54, 53, 52, 51, 50, 49, 48, //
+        47, 46, 45, 44, 43, 42, 41, 40, 39, 38, 37, 36, 35, 34, 33, 32, //
+        31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, //
+        15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0
+    );
+    // The unmasked forms of some intrinsics leave the pass-through register undefined in GCC,
+    // which -Wuninitialized reports, so the zero-masking forms with all lanes are used instead.
+    constexpr __mmask8 all_lanes = 0xff;
+    constexpr __mmask64 all_bytes = ~__mmask64(0);
+
+    // Byte i of the output is taken from the most significant byte of lane i % 8.
+    const __m512i gather_indices = _mm512_or_si512(
+        _mm512_maskz_slli_epi64(all_lanes, _mm512_and_si512(byte_iota, _mm512_set1_epi8(7)), 3),
+        _mm512_set1_epi8(7)
+    );
+
+    __m512i digits = _mm512_setzero_si512();
+    for (int i = 0; i < 5; ++i) {
+        const __m512i group = _mm512_set1_epi64(std::int64_t(groups[i]));
+        const __m512i product = _mm512_add_epi64(
+            _mm512_maskz_mul_epu32(all_lanes, group, reciprocals_lo),
+            _mm512_maskz_slli_epi64(
+                all_lanes, _mm512_maskz_mul_epu32(all_lanes, group, reciprocals_hi), 32
+            )
+        );
+        const __m512i fraction = _mm512_and_si512(product, fraction_mask);
+        // fraction * 10 == fraction * 8 + fraction * 2
+        const __m512i lanes = _mm512_add_epi64(
+            _mm512_maskz_slli_epi64(all_lanes, fraction, 3), _mm512_add_epi64(fraction, fraction)
+        );
+        digits = _mm512_mask_permutexvar_epi8(
+            digits, __mmask64(0xff) << (8 * i), gather_indices, lanes
+        );
+    }
+
+    constexpr __mmask64 all_digits = (__mmask64(1) << 40) - 1;
+    const __mmask64 nonzero = _mm512_mask_test_epi8_mask(all_digits, digits, digits);
+    const int leading_zeros = std::countr_zero(std::uint64_t(nonzero));
+    const int length = 40 - leading_zeros;
+    if (last - first < length) {
+        return { last, std::errc::value_too_large };
+    }
+
+    const __m512i shifted = _mm512_maskz_permutexvar_epi8(
+        all_bytes, _mm512_add_epi8(byte_iota, _mm512_set1_epi8(char(leading_zeros))), digits
+    );
+    const __m512i chars = _mm512_add_epi8(shifted, _mm512_set1_epi8('0'));
+    _mm512_mask_storeu_epi8(first, (__mmask64(1) << length) - 1, chars);
+    return { first + length, std::errc {} };
+}
+#endif
+
+/// @brief Returns `true` if the kernels of the backend `b` are compiled for the target.
+[[nodiscard]]
+consteval bool is_backend_available(const backend b)
+{
+    switch (b) {
+    case backend::sse:
+    case backend::avx2:
+#ifdef CHARCONV_EXT_SSE2
+        return true;
+#else
+        return false;
+#endif
+    case backend::avx512:
+#ifdef CHARCONV_EXT_X86_DISPATCH
+        return true;
+#else
+        return false;
+#endif
+    default: return true;
+    }
+}
+
+/// @brief `true` if the backend uses the SSE2 kernels, if there are any.
+template <backend Backend>
+inline constexpr bool uses_sse2 = Backend == backend::automatic || Backend == backend::sse
+    || Backend == backend::avx2 || Backend == backend::avx512;
+
+/// @brief Like `write_u64_digits`, but with one division per digit.
+constexpr void write_u64_digits_scalar(
+    char* const out, //
+    std::uint64_t x,
+    const int length,
+    const int base
+)
+{
+    for (char* p = out + length; p != out; x /= std::uint64_t(base)) {
+        *--p = digit_chars[x % std::uint64_t(base)];
+    }
+}
+
+/// @brief Like `parse_u64_digits`, but with one multiplication per digit.
+[[nodiscard]]
+constexpr std::uint64_t parse_u64_digits_scalar(const char* p, const int length, const int base)
+{
+    std::uint64_t result = 0;
+    for (const char* const last = p + length; p != last; ++p) {
+        result = result * std::uint64_t(base) + std::uint64_t(digit_value(*p));
+    }
     return result;
 }
 
-template <std::size_t N>
-constexpr std::from_chars_result from_chars(
+template <backend Backend, int FixedBase = 0>
+constexpr void write_u64_digits_with(
+    char* const out, //
+    const std::uint64_t x,
+    const int length,
+    const int base
+)
+{
+    if constexpr (Backend == backend::scalar) {
+        write_u64_digits_scalar(out, x, length, base);
+    }
+    else {
+        write_u64_digits<FixedBase>(out, x, length, base);
+    }
+}
+
+template <backend Backend, int FixedBase = 0>
+[[nodiscard]]
+constexpr std::uint64_t parse_u64_digits_with(const char* const p, const int length, const int base)
+{
+    if constexpr (Backend == backend::scalar) {
+        return parse_u64_digits_scalar(p, length, base);
+    }
+    else {
+        return parse_u64_digits<FixedBase>(p, length, base);
+    }
+}
+
+/// @brief The limbs of `to_chars_u128_constant_time` hold `digits` digits each,
+/// i.e. values below `radix`, which is the greatest power of the base below `pow(2, 31)`.
+/// `reciprocal` is `ceil(pow(2, 64) / radix)`, or exactly `pow(2, 64) / radix`.
+struct constant_time_radix {
+    std::uint32_t radix;
+    int digits;
+    std::uint64_t reciprocal;
+};
+
+/// @brief Five limbs are enough for any base,
+/// because every radix is greater than `pow(2, 31) / 36 > pow(2, 25.6)`.
+inline constexpr int constant_time_limb_count = 5;
+
+inline constexpr auto constant_time_radix_table = []() consteval {
+    std::array<constant_time_radix, 37> result {};
+    for (int base = 2; base <= 36; ++base) {
+        std::uint64_t radix = 1;
+        int digits = 0;
+        for (; radix * std::uint64_t(base) < std::uint64_t(1) << 31; ++digits) {
+            radix *= std::uint64_t(base);
+        }
+        result[std::size_t(base)] = { std::uint32_t(radix), digits, std::uint64_t(-1) / radix + 1 };
+    }
+    return result;
+}();
+
+/// @brief Returns the character for `digit`, which is less than 36,
+/// using a mask instead of a branch or a table lookup.
+[[nodiscard]]
+constexpr char digit_char_constant_time(const std::uint32_t digit)
+{
+    // 9 - digit wraps around if the digit is a letter.
+    const std::uint32_t letter_mask = 0 - ((9 - digit) >> 31);
+    return char('0' + digit + (letter_mask & ('a' - '0' - 10)));
+}
+
+/// @brief Returns the value of the digit `c` in any base up to 36, or `0xff` if `c` is no digit,
+/// using masks instead of the table lookup in `digit_value`.
+[[nodiscard]]
+constexpr std::uint32_t digit_value_constant_time(const char c)
+{
+    const auto byte = std::uint32_t(static_cast<unsigned char>(c));
+    const std::uint32_t decimal = byte - '0';
+    const std::uint32_t letter = (byte | 0x20) - 'a';
+    const std::uint32_t decimal_mask = 0 - std::uint32_t(decimal < 10);
+    const std::uint32_t letter_mask = 0 - std::uint32_t(letter < 26);
+    return (decimal & decimal_mask) | ((letter + 10) & letter_mask)
+        | (~(decimal_mask | letter_mask) & 0xff);
+}
+
+/// @brief Implements the interface of `to_chars` for 128-bit unsigned integers
+/// for the `constant_time` backend.
+///
+/// For powers of two, every digit is obtained by shifting and masking.
+/// For other bases, all 128 bits are shifted into `constant_time_limb_count` limbs in that base
+/// by doubling them and adding the next bit, where the carries between the limbs come
+/// from sign bits instead of comparisons.
+/// Every limb is then turned into the fixed-point fraction `limb / radix` with 64 bits,
+/// and every multiplication by the base moves the next digit into the upper half of the product.
+/// Only copying the digits without leading zeros depends on the length of the output.
+constexpr std::to_chars_result to_chars_u128_constant_time(
+    char* const first, //
+    char* const last,
+    const uint128_t x,
+    const int base
+)
+{
+    std::uint32_t digits[128];
+    int total_length = 0;
+
+    if (is_pow_2(base)) {
+        const int bits_per_digit = std::countr_zero(unsigned(base));
+        total_length = (128 + bits_per_digit - 1) / bits_per_digit;
+        for (int i = 0; i < total_length; ++i) {
+            const int shift = (total_length - 1 - i) * bits_per_digit;
+            digits[i] = std::uint32_t(x >> shift) & std::uint32_t(base - 1);
+        }
+    }
+    else {
+        const auto [radix, limb_digits, reciprocal] = constant_time_radix_table[std::size_t(base)];
+
+        // After n bits, the value is below pow(2, n), so only the limbs which can hold that
+        // are updated, which depends on the base but not on the value.
+        const int bits_per_limb = std::bit_width(radix) - 1;
+        std::uint32_t limbs[constant_time_limb_count] {};
+        int bit_count = 0;
+        for (const auto word : { std::uint64_t(x >> 64), std::uint64_t(x) }) {
+            for (int i = 63; i >= 0; --i) {
+                ++bit_count;
+                const int active_limbs
+                    = std::min(constant_time_limb_count, bit_count / bits_per_limb + 1);
+                auto carry = std::uint32_t(word >> i) & 1;
+                for (int j = 0; j < active_limbs; ++j) {
+                    const std::uint32_t doubled = 2 * limbs[j] + carry;
+                    // doubled - radix wraps around unless there is a carry.
+                    carry = 1 - ((doubled - radix) >> 31);
+                    limbs[j] = doubled - carry * radix;
+                }
+            }
+        }
+
+        total_length = constant_time_limb_count * limb_digits;
+        for (int i = constant_time_limb_count - 1, d = 0; i >= 0; --i) {
+            std::uint64_t fraction = limbs[i] * reciprocal;
+            for (int j = 0; j < limb_digits; ++j) {
+                const uint128_t product = uint128_t(fraction) * std::uint64_t(base);
+                digits[d++] = std::uint32_t(product >> 64);
+                fraction = std::uint64_t(product);
+            }
+        }
+    }
+
+    char chars[128];
+    int leading_zeros = 0;
+    std::uint32_t nonzero_digits = 0;
+    for (int i = 0; i < total_length; ++i) {
+        nonzero_digits |= digits[i];
+        leading_zeros += int(nonzero_digits == 0);
+        chars[i] = digit_char_constant_time(digits[i]);
+    }
+
+    // Zero is written as a single digit.
+    const int length = total_length - leading_zeros + int(leading_zeros == total_length);
+    if (last - first < length) {
+        return { last, std::errc::value_too_large };
+    }
+    std::copy_n(chars + total_length - length, length, first);
+    return { first + length, std::errc {} };
+}
+
+/// @brief Implements `from_chars_magnitude` for the `constant_time` backend,
+/// with one multiplication per digit, carried out on two 64-bit halves
+/// so that overflow is accumulated without branches.
+constexpr std::from_chars_result from_chars_magnitude_constant_time(
     const char* const first, //
     const char* const last,
-    bit_uint<N>& x,
-    const int base = 10
+    uint128_t& out,
+    const int base,
+    const uint128_t limit
 )
 {
-    using std::from_chars;
-    static_assert(
-        N <= 128, "Sorry, from_chars for unsigned _BitInt(129) and wider not implemented :("
-    );
-    detail::uint_leastN_t<N> value {};
-    auto result = from_chars(first, last, value, base);
-    x = static_cast<bit_uint<N>>(value);
-    if (result.ec == std::errc {} && x != value) {
-        // This detects the case where parsing succeeded,
-        // but the result is not exactly representable as a bit-precise integer.
-        result.ec = std::errc::result_out_of_range;
+    std::uint64_t hi = 0;
+    std::uint64_t lo = 0;
+    std::uint64_t overflow = 0;
+    const char* current = first;
+    for (; current != last; ++current) {
+        const std::uint32_t digit = digit_value_constant_time(*current);
+        if (digit >= std::uint32_t(base)) {
+            break;
+        }
+        const uint128_t lo_product = uint128_t(lo) * std::uint64_t(base) + digit;
+        const uint128_t hi_product = uint128_t(hi) * std::uint64_t(base) + (lo_product >> 64);
+        overflow |= std::uint64_t(hi_product >> 64);
+        hi = std::uint64_t(hi_product);
+        lo = std::uint64_t(lo_product);
+    }
+
+    if (current == first) {
+        return { first, std::errc::invalid_argument };
+    }
+    // Like for the other backends, the probe fires for text longer than one chunk.
+    // This only depends on the length of the text, which the timing may depend on anyway.
+    if (current - first > u64_max_representable_digits(base)) {
+        CHARCONV_EXT_PROBE(from_chars_chunks, current - first, base);
+    }
+    const uint128_t result = (uint128_t(hi) << 64) | lo;
+    if ((overflow != 0) | (result > limit)) {
+        CHARCONV_EXT_PROBE(out_of_range, current - first, base);
+        return { current, std::errc::result_out_of_range };
+    }
+    out = result;
+    return { current, std::errc {} };
+}
+
+/// @brief Parses the longest sequence of digits at the start of `[first, last)`
+/// as the magnitude of an integer, and fails if the magnitude exceeds `limit`.
+///
+/// The digits are consumed left to right in a single pass,
+/// in chunks of as many digits as fit into `std::uint64_t`.
+/// The leading chunk is the shortest one, so that every subsequent chunk
+/// is exactly `u64_max_representable_digits(base)` long and shifts the result
+/// by `pow(base, u64_max_representable_digits(base))`.
+/// Overflow of the intermediate results is accumulated in a flag,
+/// so there is only one branch which checks for a value out of range.
+template <backend Backend = backend::automatic, int FixedBase = 0>
+constexpr std::from_chars_result from_chars_magnitude(
+    const char* const first, //
+    const char* const last,
+    uint128_t& out,
+    const int base,
+    const uint128_t limit
+)
+{
+    CHARCONV_EXT_ASSERT(FixedBase == 0 || base == FixedBase);
+
+    if constexpr (Backend == backend::constant_time) {
+        return from_chars_magnitude_constant_time(first, last, out, base, limit);
+    }
+#ifdef CHARCONV_EXT_SSE2
+    if constexpr (uses_sse2<Backend> && (FixedBase == 0 || FixedBase == 2)) {
+        if ((FixedBase == 2 || base == 2) && !std::is_constant_evaluated()) {
+            return from_chars_binary_sse2(first, last, out, limit);
+        }
+    }
+#endif
+    const auto length = std::ptrdiff_t(pattern_length(first, last, base));
+    if (length == 0) {
+        return { first, std::errc::invalid_argument };
+    }
+    const char* const digits_last = first + length;
+
+    const std::ptrdiff_t chunk_length = u64_max_representable_digits(base);
+    const std::uint64_t max_pow = u64_max_power(base);
+    const uint128_t chunk_factor = max_pow == 0 ? uint128_t { 1 } << 64 : uint128_t { max_pow };
+
+    const std::ptrdiff_t head_length = (length - 1) % chunk_length + 1;
+    const char* current = first + head_length;
+
+    uint128_t result = parse_u64_digits_with<Backend, FixedBase>(first, int(head_length), base);
+    bool overflow = false;
+
+    if (current != digits_last) {
+        CHARCONV_EXT_PROBE(from_chars_chunks, length, base);
+    }
+    for (; current != digits_last; current += chunk_length) {
+        const std::uint64_t chunk
+            = parse_u64_digits_with<Backend, FixedBase>(current, int(chunk_length), base);
+        overflow |= mul_overflow(result, result, chunk_factor);
+        overflow |= add_overflow(result, result, chunk);
+    }
+
+    if (overflow || result > limit) {
+        CHARCONV_EXT_PROBE(out_of_range, length, base);
+        return { digits_last, std::errc::result_out_of_range };
+    }
+    out = result;
+    return { digits_last, std::errc {} };
+}
+
+/// @brief Implements the interface of `from_chars` for 128-bit unsigned integers.
+/// See `from_chars_magnitude` for details.
+template <backend Backend>
+constexpr std::from_chars_result
+from_chars_128(const char* const first, const char* const last, uint128_t& out, const int base)
+{
+    CHARCONV_EXT_ASSERT(base >= 2);
+    CHARCONV_EXT_ASSERT(base <= 36);
+    CHARCONV_EXT_ASSERT(first);
+    CHARCONV_EXT_ASSERT(last);
+
+    return from_chars_magnitude<Backend>(first, last, out, base, uint128_t(-1));
+}
+
+/// @brief Implements the interface of `from_chars` for 128-bit signed integers.
+/// The magnitude is parsed in the same single pass as for unsigned integers,
+/// except that the bound is `pow(2, 127)` for negative and `pow(2, 127) - 1`
+/// for non-negative numbers.
+template <backend Backend>
+constexpr std::from_chars_result
+from_chars_128(const char* const first, const char* const last, int128_t& out, const int base)
+{
+    CHARCONV_EXT_ASSERT(base >= 2);
+    CHARCONV_EXT_ASSERT(base <= 36);
+    CHARCONV_EXT_ASSERT(first);
+    CHARCONV_EXT_ASSERT(last);
+
+    const bool negative = first != last && *first == '-';
+    const uint128_t limit = (uint128_t { 1 } << 127) - !negative;
+
+    uint128_t magnitude {};
+    const std::from_chars_result result
+        = from_chars_magnitude<Backend>(first + negative, last, magnitude, base, limit);
+    if (result.ec == std::errc::invalid_argument) {
+        return { first, result.ec };
+    }
+    if (result.ec == std::errc {}) {
+        out = int128_t(negative ? -magnitude : magnitude);
     }
     return result;
 }
+
+/// @brief Implements the interface of `to_chars` for 128-bit unsigned integers.
+/// The value is split into at most three chunks of `u64_max_representable_digits(base)` digits.
+/// All chunks except the most significant one have a known length,
+/// so the total length is known and checked before any digit is written,
+/// and no digits need to be moved around for zero-padding.
+template <backend Backend, int FixedBase = 0>
+constexpr std::to_chars_result
+to_chars_128(char* const first, char* const last, const uint128_t x, const int base)
+{
+    CHARCONV_EXT_ASSERT(first);
+    CHARCONV_EXT_ASSERT(last);
+    CHARCONV_EXT_ASSERT(base >= 2);
+    CHARCONV_EXT_ASSERT(base <= 36);
+    CHARCONV_EXT_ASSERT(FixedBase == 0 || base == FixedBase);
+
+    if constexpr (Backend == backend::constant_time) {
+        return to_chars_u128_constant_time(first, last, x, base);
+    }
+#ifdef CHARCONV_EXT_SSE2
+    if constexpr (uses_sse2<Backend> && (FixedBase == 0 || FixedBase == 2)) {
+        if ((FixedBase == 2 || base == 2) && !std::is_constant_evaluated()) {
+            return to_chars_u128_binary_sse2(first, last, x);
+        }
+    }
+#endif
+    if (x <= std::uint64_t(-1)) {
+        const int length = u64_digit_count<FixedBase>(std::uint64_t(x), base);
+        if (last - first < length) {
+            return { last, std::errc::value_too_large };
+        }
+        write_u64_digits_with<Backend, FixedBase>(first, std::uint64_t(x), length, base);
+        return { first + length, std::errc {} };
+    }
+#ifdef CHARCONV_EXT_X86_DISPATCH
+    if constexpr ((Backend == backend::automatic || Backend == backend::avx512)
+                  && may_be_decimal<FixedBase>) {
+        if ((FixedBase == 10 || base == 10) && !std::is_constant_evaluated()
+            && (Backend == backend::avx512 || has_avx512vbmi())) {
+            CHARCONV_EXT_ASSERT(has_avx512vbmi());
+            const std::to_chars_result result = to_chars_u128_decimal_avx512(first, last, x);
+            CHARCONV_EXT_PROBE(to_chars_split, result.ptr - first, base);
+            return result;
+        }
+    }
+#endif
+
+    const std::uint64_t max_pow = u64_max_power(base);
+    const int piece_max_digits = u64_max_representable_digits(base);
+    // For bases like 2 and 16, the chunks are obtained by shifting and masking,
+    // and for any other base by a precomputed divider.
+    // The greatest power of a base that fits into 64 bits is a power of two
+    // (or zero, for `pow(2, 64)`) exactly if the base is one.
+    const int bits_per_piece = max_pow == 0 ? 64 : std::countr_zero(max_pow);
+    const uint128_t piece_factor = max_pow == 0 ? uint128_t { 1 } << 64 : uint128_t { max_pow };
+
+    std::uint64_t pieces[2];
+    int piece_count = 0;
+    uint128_t head = x;
+    while (head > std::uint64_t(-1)) {
+        if constexpr (may_be_pow_2<FixedBase>) {
+            if (FixedBase != 0 || (max_pow & (max_pow - 1)) == 0) {
+                pieces[piece_count++] = std::uint64_t(head & (piece_factor - 1));
+                head >>= bits_per_piece;
+                continue;
+            }
+        }
+        if constexpr (FixedBase == 0 || !is_pow_2(FixedBase)) {
+            const auto [quotient, remainder]
+                = u64_max_power_dividers[std::size_t(base)].divmod(head);
+            pieces[piece_count++] = remainder;
+            head = quotient;
+        }
+    }
+
+    const int head_length = u64_digit_count<FixedBase>(std::uint64_t(head), base);
+    const int length = head_length + piece_count * piece_max_digits;
+    CHARCONV_EXT_PROBE(to_chars_split, length, base);
+    if (last - first < length) {
+        return { last, std::errc::value_too_large };
+    }
+
+    write_u64_digits_with<Backend, FixedBase>(first, std::uint64_t(head), head_length, base);
+    char* current = first + head_length;
+    while (piece_count != 0) {
+        write_u64_digits_with<Backend, FixedBase>(
+            current, pieces[--piece_count], piece_max_digits, base
+        );
+        current += piece_max_digits;
+    }
+    return { current, std::errc {} };
+}
+
+template <backend Backend, int FixedBase = 0>
+constexpr std::to_chars_result
+to_chars_128(char* const first, char* const last, const int128_t x, const int base)
+{
+    CHARCONV_EXT_ASSERT(first);
+    CHARCONV_EXT_ASSERT(last);
+    CHARCONV_EXT_ASSERT(base >= 2);
+    CHARCONV_EXT_ASSERT(base <= 36);
+
+    if (x >= 0) {
+        return to_chars_128<Backend, FixedBase>(first, last, uint128_t(x), base);
+    }
+    if (first == last) {
+        return { last, std::errc::value_too_large };
+    }
+    *first = '-';
+    return to_chars_128<Backend, FixedBase>(first + 1, last, -uint128_t(x), base);
+}
+
+} // namespace detail
+
+// Recent versions of GCC and Clang (~2025) already provide support for __int128
+// in to_chars and from_chars, so we should avoid
+#if !defined(CHARCONV_EXT_128_BIT_PROVIDED_BY_STANDARD_LIBRARY)                                    \
+    || defined(CHARCONV_EXT_DONT_USE_STANDARD_LIBRARY)
+#define CHARCONV_EXT_128_BIT_IMPLEMENTATION 1
+
+/// @brief Implements the interface of `from_chars` for 128-bit unsigned integers,
+/// using the `automatic` backend.
+constexpr std::from_chars_result
+from_chars(const char* const first, const char* const last, uint128_t& out, const int base = 10)
+{
+    return detail::from_chars_128<backend::automatic>(first, last, out, base);
+}
+
+/// @brief Implements the interface of `from_chars` for 128-bit signed integers,
+/// using the `automatic` backend.
+constexpr std::from_chars_result
+from_chars(const char* const first, const char* const last, int128_t& out, const int base = 10)
+{
+    return detail::from_chars_128<backend::automatic>(first, last, out, base);
+}
+
+/// @brief Implements the interface of `to_chars` for 128-bit unsigned integers,
+/// using the `automatic` backend.
+constexpr std::to_chars_result
+to_chars(char* const first, char* const last, const uint128_t x, const int base = 10)
+{
+    return detail::to_chars_128<backend::automatic>(first, last, x, base);
+}
+
+/// @brief Implements the interface of `to_chars` for 128-bit signed integers,
+/// using the `automatic` backend.
+constexpr std::to_chars_result
+to_chars(char* const first, char* const last, const int128_t x, const int base = 10)
+{
+    return detail::to_chars_128<backend::automatic>(first, last, x, base);
+}
+
+#endif
+
+#ifdef CHARCONV_EXT_BITINT_MAXWIDTH
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wbit-int-extension"
+#endif
+
+template <std::size_t N>
+using bit_int = _BitInt(N);
+template <std::size_t N>
+using bit_uint = unsigned _BitInt(N);
+
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif
+
+namespace detail {
+
+template <std::size_t N>
+consteval auto int_least()
+{
+    if constexpr (N <= 8) {
+        return std::int_least8_t {};
+    }
+    else if constexpr (N <= 16) {
+        return std::int_least16_t {};
+    }
+    else if constexpr (N <= 32) {
+        return std::int_least32_t {};
+    }
+    else if constexpr (N <= 64) {
+        return std::int_least64_t {};
+    }
+    else if constexpr (N <= 128) {
+        return int128_t {};
+    }
+}
+
+template <std::size_t N>
+consteval auto uint_least()
+{
+    if constexpr (N <= 8) {
+        return std::uint_least8_t {};
+    }
+    else if constexpr (N <= 16) {
+        return std::uint_least16_t {};
+    }
+    else if constexpr (N <= 32) {
+        return std::uint_least32_t {};
+    }
+    else if constexpr (N <= 64) {
+        return std::uint_least64_t {};
+    }
+    else if constexpr (N <= 128) {
+        return uint128_t {};
+    }
+}
+
+template <std::size_t N>
+using int_leastN_t = decltype(int_least<N>());
+
+template <std::size_t N>
+using uint_leastN_t = decltype(uint_least<N>());
+
+} // namespace detail
+
+#endif
+
+/// @brief Provides `to_chars` and `from_chars` for 128-bit and bit-precise integers,
+/// like the free functions, but implemented by the given backend.
+/// This allows comparing implementations within one program, or pinning one per deployment.
+template <backend Backend = backend::automatic>
+struct basic_converter {
+    /// @brief `true` if the kernels of `Backend` are compiled for the target.
+    /// Using the member functions of a converter which is not available is ill-formed.
+    static constexpr bool available = detail::is_backend_available(Backend);
+
+    /// @brief Returns `true` if the backend is available and the CPU supports its kernels.
+    [[nodiscard]]
+    static bool supported()
+    {
+#ifdef CHARCONV_EXT_X86_DISPATCH
+        if constexpr (Backend == backend::avx512) {
+            return detail::has_avx512vbmi();
+        }
+#endif
+        return available;
+    }
+
+    static constexpr std::to_chars_result
+    to_chars(char* const first, char* const last, const uint128_t x, const int base = 10)
+    {
+        static_assert(available);
+        return detail::to_chars_128<Backend>(first, last, x, base);
+    }
+
+    static constexpr std::to_chars_result
+    to_chars(char* const first, char* const last, const int128_t x, const int base = 10)
+    {
+        static_assert(available);
+        return detail::to_chars_128<Backend>(first, last, x, base);
+    }
+
+    static constexpr std::from_chars_result from_chars(
+        const char* const first, //
+        const char* const last,
+        uint128_t& out,
+        const int base = 10
+    )
+    {
+        static_assert(available);
+        return detail::from_chars_128<Backend>(first, last, out, base);
+    }
+
+    static constexpr std::from_chars_result from_chars(
+        const char* const first, //
+        const char* const last,
+        int128_t& out,
+        const int base = 10
+    )
+    {
+        static_assert(available);
+        return detail::from_chars_128<Backend>(first, last, out, base);
+    }
+
+#ifdef CHARCONV_EXT_BITINT_MAXWIDTH
+    // With the automatic backend, bit-precise integers with up to 64 bits are converted
+    // by the standard library. Otherwise, they are widened to 128 bits,
+    // so that the kernels of the backend are used for every width.
+
+    template <std::size_t N>
+    static constexpr std::to_chars_result to_chars(
+        char* const first, //
+        char* const last,
+        const bit_int<N> x,
+        const int base = 10
+    )
+    {
+        static_assert(N <= 128, "Sorry, to_chars for _BitInt(129) and wider not implemented :(");
+        if constexpr (N <= 64 && Backend == backend::automatic) {
+            return std::to_chars(first, last, detail::int_leastN_t<N> { x }, base);
+        }
+        else {
+            const std::to_chars_result result = to_chars(first, last, int128_t { x }, base);
+            if constexpr (N > 64) {
+                CHARCONV_EXT_PROBE(bitint_to_chars, result.ptr - first, base);
+            }
+            return result;
+        }
+    }
+
+    template <std::size_t N>
+    static constexpr std::to_chars_result to_chars(
+        char* const first, //
+        char* const last,
+        const bit_uint<N> x,
+        const int base = 10
+    )
+    {
+        static_assert(N <= 128, "Sorry, to_chars for _BitInt(129) and wider not implemented :(");
+        if constexpr (N <= 64 && Backend == backend::automatic) {
+            return std::to_chars(first, last, detail::uint_leastN_t<N> { x }, base);
+        }
+        else {
+            const std::to_chars_result result = to_chars(first, last, uint128_t { x }, base);
+            if constexpr (N > 64) {
+                CHARCONV_EXT_PROBE(bitint_to_chars, result.ptr - first, base);
+            }
+            return result;
+        }
+    }
+
+    template <std::size_t N>
+    static constexpr std::from_chars_result from_chars(
+        const char* const first, //
+        const char* const last,
+        bit_int<N>& x,
+        const int base = 10
+    )
+    {
+        static_assert(N <= 128, "Sorry, from_chars for _BitInt(129) and wider not implemented :(");
+        constexpr bool narrow = N <= 64 && Backend == backend::automatic;
+        std::conditional_t<narrow, detail::int_leastN_t<N>, int128_t> value {};
+        std::from_chars_result result;
+        if constexpr (narrow) {
+            result = std::from_chars(first, last, value, base);
+        }
+        else {
+            result = from_chars(first, last, value, base);
+            if constexpr (N > 64) {
+                CHARCONV_EXT_PROBE(bitint_from_chars, result.ptr - first, base);
+            }
+        }
+        x = static_cast<bit_int<N>>(value);
+        if (result.ec == std::errc {} && x != value) {
+            // This detects the case where parsing succeeded,
+            // but the result is not exactly representable as a bit-precise integer.
+            CHARCONV_EXT_PROBE(out_of_range, result.ptr - first, base);
+            result.ec = std::errc::result_out_of_range;
+        }
+        return result;
+    }
+
+    template <std::size_t N>
+    static constexpr std::from_chars_result from_chars(
+        const char* const first, //
+        const char* const last,
+        bit_uint<N>& x,
+        const int base = 10
+    )
+    {
+        static_assert(
+            N <= 128, "Sorry, from_chars for unsigned _BitInt(129) and wider not implemented :("
+        );
+        constexpr bool narrow = N <= 64 && Backend == backend::automatic;
+        std::conditional_t<narrow, detail::uint_leastN_t<N>, uint128_t> value {};
+        std::from_chars_result result;
+        if constexpr (narrow) {
+            result = std::from_chars(first, last, value, base);
+        }
+        else {
+            result = from_chars(first, last, value, base);
+            if constexpr (N > 64) {
+                CHARCONV_EXT_PROBE(bitint_from_chars, result.ptr - first, base);
+            }
+        }
+        x = static_cast<bit_uint<N>>(value);
+        if (result.ec == std::errc {} && x != value) {
+            // This detects the case where parsing succeeded,
+            // but the result is not exactly representable as a bit-precise integer.
+            CHARCONV_EXT_PROBE(out_of_range, result.ptr - first, base);
+            result.ec = std::errc::result_out_of_range;
+        }
+        return result;
+    }
+#endif
+};
+
+#ifdef CHARCONV_EXT_BITINT_MAXWIDTH
+template <std::size_t N>
+constexpr std::to_chars_result to_chars(
+    char* const first, //
+    char* const last,
+    const bit_int<N> x,
+    const int base = 10
+)
+{
+    return basic_converter<>::to_chars(first, last, x, base);
+}
+
+template <std::size_t N>
+constexpr std::to_chars_result to_chars(
+    char* const first, //
+    char* const last,
+    const bit_uint<N> x,
+    const int base = 10
+)
+{
+    return basic_converter<>::to_chars(first, last, x, base);
+}
+
+template <std::size_t N>
+constexpr std::from_chars_result from_chars(
+    const char* const first, //
+    const char* const last,
+    bit_int<N>& x,
+    const int base = 10
+)
+{
+    return basic_converter<>::from_chars(first, last, x, base);
+}
+
+template <std::size_t N>
+constexpr std::from_chars_result from_chars(
+    const char* const first, //
+    const char* const last,
+    bit_uint<N>& x,
+    const int base = 10
+)
+{
+    return basic_converter<>::from_chars(first, last, x, base);
+}
+#endif
+
+namespace detail {
+
+template <typename T>
+struct is_extended_integer : std::bool_constant<
+                                 std::is_same_v<T, int128_t> || std::is_same_v<T, uint128_t>> { };
+
+#ifdef CHARCONV_EXT_BITINT_MAXWIDTH
+template <std::size_t N>
+struct is_extended_integer<bit_int<N>> : std::true_type { };
+template <std::size_t N>
+struct is_extended_integer<bit_uint<N>> : std::true_type { };
+#endif
+
+// The utilities below are generic, and have to call the right overload of to_chars and from_chars
+// for any integer type, regardless of whether 128-bit support comes from the standard library
+// or from us.
+// Simply making all overloads visible would be ambiguous for 128-bit integers
+// if both provide them.
+
+template <typename T>
+constexpr std::to_chars_result
+to_chars_any(char* const first, char* const last, const T x, const int base)
+{
+    if constexpr (is_extended_integer<T>::value) {
+        return charconv_ext::to_chars(first, last, x, base);
+    }
+    else {
+        return std::to_chars(first, last, x, base);
+    }
+}
+
+template <typename T>
+constexpr std::from_chars_result
+from_chars_any(const char* const first, const char* const last, T& out, const int base)
+{
+    if constexpr (is_extended_integer<T>::value) {
+        return charconv_ext::from_chars(first, last, out, base);
+    }
+    else {
+        return std::from_chars(first, last, out, base);
+    }
+}
+
+template <typename T>
+inline constexpr bool is_signed_integer = T(-1) < T(0);
+
+/// @brief The number of bits of `T`, not counting the sign bit.
+template <typename T>
+inline constexpr int value_bits = std::numeric_limits<T>::digits;
+template <>
+inline constexpr int value_bits<int128_t> = 127;
+template <>
+inline constexpr int value_bits<uint128_t> = 128;
+#ifdef CHARCONV_EXT_BITINT_MAXWIDTH
+template <std::size_t N>
+inline constexpr int value_bits<bit_int<N>> = int(N) - 1;
+template <std::size_t N>
+inline constexpr int value_bits<bit_uint<N>> = int(N);
+#endif
+
+template <typename T>
+inline constexpr auto max_chars_table = []() consteval {
+    constexpr int bits = value_bits<T>;
+    std::array<int, 37> result {};
+    for (int base = 2; base <= 36; ++base) {
+        int length = int(is_signed_integer<T>);
+        if constexpr (bits <= 128) {
+            // The longest text is that of the minimum of signed and the maximum of unsigned
+            // integers.
+            constexpr uint128_t magnitude
+                = is_signed_integer<T> ? uint128_t { 1 } << bits : uint128_t(-1) >> (128 - bits);
+            for (uint128_t x = magnitude; x != 0; x /= uint128_t(base)) {
+                ++length;
+            }
+        }
+        else {
+            // Every digit holds at least floor(log2(base)) bits.
+            const int bits_per_digit = std::bit_width(unsigned(base)) - 1;
+            length += (bits + is_signed_integer<T> + bits_per_digit - 1) / bits_per_digit;
+        }
+        result[std::size_t(base)] = std::max(length, 1);
+    }
+    return result;
+}();
+
+/// @brief Like `to_chars_any`, but with the base as a template argument,
+/// so that the kernel for the base is selected at compile time.
+/// The value is widened to 128 bits, which costs nothing for values which fit into 64 bits,
+/// since `to_chars_128` converts these separately.
+template <int Base, typename T>
+constexpr std::to_chars_result to_chars_fixed_base(char* const first, char* const last, const T x)
+{
+    static_assert(value_bits<T> <= 128, "Fixed-base conversions are limited to 128 bits.");
+    if constexpr (is_signed_integer<T>) {
+        return to_chars_128<backend::automatic, Base>(first, last, int128_t(x), Base);
+    }
+    else {
+        return to_chars_128<backend::automatic, Base>(first, last, uint128_t(x), Base);
+    }
+}
+
+/// @brief Like `from_chars_any`, but with the base as a template argument.
+/// See `to_chars_fixed_base` for details.
+template <int Base, typename T>
+constexpr std::from_chars_result
+from_chars_fixed_base(const char* const first, const char* const last, T& out)
+{
+    static_assert(value_bits<T> <= 128, "Fixed-base conversions are limited to 128 bits.");
+    constexpr uint128_t max = uint128_t(-1) >> (128 - value_bits<T>);
+    const bool negative = is_signed_integer<T> && first != last && *first == '-';
+
+    uint128_t magnitude {};
+    const std::from_chars_result result = from_chars_magnitude<backend::automatic, Base>(
+        first + negative, last, magnitude, Base, max + negative
+    );
+    if (result.ec == std::errc::invalid_argument) {
+        return { first, result.ec };
+    }
+    if (result.ec == std::errc {}) {
+        out = T(negative ? -magnitude : magnitude);
+    }
+    return result;
+}
+
+[[nodiscard]]
+constexpr bool is_integer_start(
+    const char* const p, //
+    const char* const last,
+    const int base,
+    const bool allow_minus
+)
+{
+    const int value = digit_value(*p);
+    if (value >= 0 && value < base) {
+        return true;
+    }
+    if (allow_minus && *p == '-' && p + 1 != last) {
+        const int next = digit_value(p[1]);
+        return next >= 0 && next < base;
+    }
+    return false;
+}
+
+#ifdef CHARCONV_EXT_SSE2
+/// @brief Returns a mask where bit `i` is set if `p[i]` is a digit in the given base,
+/// or a minus sign if `allow_minus` is `true`.
+[[nodiscard]]
+inline unsigned
+integer_candidate_mask_sse2(const char* const p, const int base, const bool allow_minus)
+{
+    const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+
+    // Unsigned "x < limit" is computed as "min(x, limit - 1) == x".
+    const __m128i decimal = _mm_sub_epi8(chunk, _mm_set1_epi8('0'));
+    const __m128i decimal_max = _mm_set1_epi8(char(std::min(base, 10) - 1));
+    __m128i result = _mm_cmpeq_epi8(_mm_min_epu8(decimal, decimal_max), decimal);
+
+    if (base > 10) {
+        const __m128i lower = _mm_or_si128(chunk, _mm_set1_epi8(0x20));
+        const __m128i letter = _mm_sub_epi8(lower, _mm_set1_epi8('a'));
+        const __m128i letter_max = _mm_set1_epi8(char(base - 11));
+        result = _mm_or_si128(result, _mm_cmpeq_epi8(_mm_min_epu8(letter, letter_max), letter));
+    }
+    if (allow_minus) {
+        result = _mm_or_si128(result, _mm_cmpeq_epi8(chunk, _mm_set1_epi8('-')));
+    }
+    return unsigned(_mm_movemask_epi8(result));
+}
+#endif
+
+/// @brief Returns a pointer to the first character in `[first, last)`
+/// at which an integer in the given base begins, or `last` if there is none.
+/// If `allow_minus` is `true`, a minus sign immediately followed by a digit
+/// is also considered the start of an integer.
+[[nodiscard]]
+constexpr const char* find_integer_start(
+    const char* first, //
+    const char* const last,
+    const int base,
+    const bool allow_minus
+)
+{
+#ifdef CHARCONV_EXT_SSE2
+    if (!std::is_constant_evaluated()) {
+        // Most bytes in free text are not digits,
+        // so we skip over 16 of them at a time and only look closer at candidates.
+        while (last - first >= 16) {
+            unsigned mask = integer_candidate_mask_sse2(first, base, allow_minus);
+            while (mask != 0) {
+                const char* const candidate = first + std::countr_zero(mask);
+                if (is_integer_start(candidate, last, base, allow_minus)) {
+                    return candidate;
+                }
+                mask &= mask - 1;
+            }
+            first += 16;
+        }
+    }
+#endif
+    for (; first != last; ++first) {
+        if (is_integer_start(first, last, base, allow_minus)) {
+            return first;
+        }
+    }
+    return last;
+}
+
+} // namespace detail
+
+/// @brief Returns the greatest number of characters that `to_chars` writes
+/// for any value of the integer type `T` in the given base, including the minus sign.
+/// For types wider than 128 bits, this is an upper bound instead.
+template <typename T>
+[[nodiscard]]
+constexpr int max_chars(const int base = 10)
+{
+    CHARCONV_EXT_ASSERT(base >= 2);
+    CHARCONV_EXT_ASSERT(base <= 36);
+
+    return detail::max_chars_table<T>[std::size_t(base)];
+}
+
+/// @brief The result of `find_next_integer`.
+/// `[first, ptr)` is the range of the integer token that was found,
+/// including its sign.
+struct find_integer_result {
+    const char* first;
+    const char* ptr;
+    std::errc ec;
+};
+
+/// @brief Skips over any characters in `[first, last)` which cannot begin an integer,
+/// and parses the next integer token with `from_chars`.
+template <typename T>
+constexpr find_integer_result find_next_integer(
+    const char* const first, //
+    const char* const last,
+    T& out,
+    const int base = 10
+)
+{
+    CHARCONV_EXT_ASSERT(first);
+    CHARCONV_EXT_ASSERT(last);
+    CHARCONV_EXT_ASSERT(base >= 2);
+    CHARCONV_EXT_ASSERT(base <= 36);
+
+    const char* const start
+        = detail::find_integer_start(first, last, base, detail::is_signed_integer<T>);
+    if (start == last) {
+        return { last, last, std::errc::invalid_argument };
+    }
+    const std::from_chars_result result = detail::from_chars_any(start, last, out, base);
+    // find_integer_start guarantees that at least one digit follows,
+    // so the parse can only fail by going out of range.
+    CHARCONV_EXT_ASSERT(result.ec != std::errc::invalid_argument);
+    return { start, result.ptr, result.ec };
+}
+
+/// @brief The alternative of `adaptive_integer` for a value which does not fit into `int128_t`.
+struct overflow_digits {
+    /// @brief The number of digits, not counting the sign or leading zeros.
+    std::size_t count;
+
+    friend constexpr bool operator==(const overflow_digits&, const overflow_digits&) = default;
+};
+
+/// @brief The narrowest of `std::int64_t` and `int128_t` which holds a parsed value,
+/// or `overflow_digits` if it fits into neither.
+using adaptive_integer = std::variant<std::int64_t, int128_t, overflow_digits>;
+
+/// @brief Parses an integer like `from_chars` for `int128_t`, but stores it in the narrowest
+/// alternative of `adaptive_integer`.
+/// The number of significant digits decides how the value is parsed:
+/// values with few enough digits to fit into `std::uint64_t` are parsed without any 128-bit
+/// arithmetic, and values out of range are reported as `overflow_digits` (with `std::errc {}`).
+constexpr std::from_chars_result from_chars_adaptive(
+    const char* const first, //
+    const char* const last,
+    adaptive_integer& out,
+    const int base = 10
+)
+{
+    CHARCONV_EXT_ASSERT(first);
+    CHARCONV_EXT_ASSERT(last);
+    CHARCONV_EXT_ASSERT(base >= 2);
+    CHARCONV_EXT_ASSERT(base <= 36);
+
+    const bool negative = first != last && *first == '-';
+    const char* digits_first = first + negative;
+    const char* const digits_last = digits_first + detail::pattern_length(digits_first, last, base);
+    if (digits_first == digits_last) {
+        return { first, std::errc::invalid_argument };
+    }
+    while (digits_last - digits_first > 1 && *digits_first == '0') {
+        ++digits_first;
+    }
+
+    const std::ptrdiff_t length = digits_last - digits_first;
+    const std::uint64_t i64_limit = (std::uint64_t { 1 } << 63) - !negative;
+    if (length <= detail::u64_max_representable_digits(base)) {
+        const std::uint64_t magnitude = detail::parse_u64_digits(digits_first, int(length), base);
+        if (magnitude <= i64_limit) {
+            out = std::int64_t(negative ? 0 - magnitude : magnitude);
+        }
+        else {
+            out = negative ? -int128_t(magnitude) : int128_t(magnitude);
+        }
+        return { digits_last, std::errc {} };
+    }
+
+    int128_t value {};
+    const std::from_chars_result result = detail::from_chars_any(first, digits_last, value, base);
+    if (result.ec == std::errc::result_out_of_range) {
+        out = overflow_digits { std::size_t(length) };
+    }
+    // In large bases, a value with one more digit than fits into std::uint64_t
+    // can still fit into std::int64_t.
+    else if (value >= std::numeric_limits<std::int64_t>::min()
+             && value <= std::numeric_limits<std::int64_t>::max()) {
+        out = std::int64_t(value);
+    }
+    else {
+        out = value;
+    }
+    return { digits_last, std::errc {} };
+}
+
+namespace detail {
+
+/// @brief Returns `true` if the last letter in `[first, last)` is uppercase,
+/// and `false` if it is lowercase or if there are no letters.
+[[nodiscard]]
+constexpr bool is_last_letter_upper(const char* const first, const char* last)
+{
+    while (last != first) {
+        const char c = *--last;
+        if (c >= 'A' && c <= 'Z') {
+            return true;
+        }
+        if (c >= 'a' && c <= 'z') {
+            return false;
+        }
+    }
+    return false;
+}
+
+constexpr void to_upper_digits(char* first, char* const last)
+{
+    for (; first != last; ++first) {
+        *first = *first >= 'a' ? char(*first - 'a' + 'A') : *first;
+    }
+}
+
+} // namespace detail
+
+/// @brief Adds `delta` to the non-negative integer whose digits in the given base
+/// are `[first, last)`, in place, such as to the output of `to_chars`.
+/// The text may be longer than the digits of any integer type.
+///
+/// If the carry propagates past the first digit, the digits are moved to the right,
+/// and the new leading digits are written to `[first, ...)`,
+/// which requires space in `[last, end)`.
+/// Otherwise, `ptr` is `last`, or `end` with `std::errc::value_too_large`
+/// if there is not enough space, in which case the text is not modified.
+/// Letters are written in the case of the last letter of the text, or in lowercase
+/// if there is none, so that uppercase text stays uppercase.
+///
+/// When the carry does not pass the last digit, only that digit is replaced.
+/// When the carry does not pass the last eight digits, these are parsed, incremented,
+/// and written at once, which takes SWAR (SIMD within a register) for decimal digits.
+constexpr std::to_chars_result increment_chars(
+    char* const first, //
+    char* const last,
+    char* const end,
+    const int base,
+    const std::uint64_t delta = 1
+)
+{
+    CHARCONV_EXT_ASSERT(first);
+    CHARCONV_EXT_ASSERT(last);
+    CHARCONV_EXT_ASSERT(end);
+    CHARCONV_EXT_ASSERT(base >= 2);
+    CHARCONV_EXT_ASSERT(base <= 36);
+    CHARCONV_EXT_ASSERT(detail::pattern_length(first, last, base) == std::size_t(last - first));
+
+    if (first != last) {
+        const char last_char = last[-1];
+        const auto last_digit = std::uint64_t(detail::digit_value(last_char));
+        if (delta < std::uint64_t(base) - last_digit) {
+            const std::uint64_t digit = last_digit + delta;
+            // Only a letter which replaces a decimal digit has to look for the case elsewhere.
+            const bool upper = last_digit >= 10
+                ? last_char <= 'Z'
+                : digit >= 10 && detail::is_last_letter_upper(first, last);
+            last[-1] = (upper ? detail::upper_digit_chars : detail::digit_chars)[digit];
+            return { last, std::errc {} };
+        }
+    }
+    const bool upper = base > 10 && detail::is_last_letter_upper(first, last);
+    const char* const digit_chars = upper ? detail::upper_digit_chars : detail::digit_chars;
+
+    constexpr int tail_length = 8;
+    if (last - first >= tail_length) {
+        const std::uint64_t base_pow_2 = std::uint64_t(base) * std::uint64_t(base);
+        const std::uint64_t tail_limit = base_pow_2 * base_pow_2 * base_pow_2 * base_pow_2;
+        const std::uint64_t tail = detail::parse_u64_digits(last - tail_length, tail_length, base);
+        if (delta < tail_limit - tail) {
+            detail::write_u64_digits(last - tail_length, tail + delta, tail_length, base);
+            if (upper) {
+                detail::to_upper_digits(last - tail_length, last);
+            }
+            return { last, std::errc {} };
+        }
+    }
+
+    // Adds the carry to the digit at p, and returns the new carry.
+    // The carry is divided before the digit is added to it, so that it cannot overflow.
+    const auto add_carry = [base](const char* const p, const std::uint64_t carry, int& digit) {
+        const auto b = std::uint64_t(base);
+        const std::uint64_t sum = carry % b + std::uint64_t(detail::digit_value(*p));
+        digit = int(sum % b);
+        return carry / b + sum / b;
+    };
+
+    // The first pass only finds out whether the text grows, so that it is not modified
+    // if there is not enough space for that.
+    std::uint64_t carry = delta;
+    char* current = last;
+    for (int digit = 0; carry != 0 && current != first;) {
+        carry = add_carry(--current, carry, digit);
+    }
+    const int growth = carry == 0 ? 0 : detail::u64_digit_count(carry, base);
+    if (end - last < growth) {
+        return { end, std::errc::value_too_large };
+    }
+    if (growth != 0) {
+        std::copy_backward(first, last, last + growth);
+        detail::write_u64_digits(first, carry, growth, base);
+        if (upper) {
+            detail::to_upper_digits(first, first + growth);
+        }
+    }
+
+    carry = delta;
+    for (char* p = last + growth; carry != 0 && p != first + growth;) {
+        int digit = 0;
+        carry = add_carry(--p, carry, digit);
+        *p = digit_chars[digit];
+    }
+    return { last + growth, std::errc {} };
+}
+
+namespace detail {
+
+/// @brief The number of digits of `uint128_t(-1)` in every base.
+inline constexpr auto u128_max_digits_table = []() consteval {
+    std::array<int, 37> result {};
+    for (int base = 2; base <= 36; ++base) {
+        for (uint128_t x = uint128_t(-1); x != 0; x /= uint128_t(base)) {
+            ++result[std::size_t(base)];
+        }
+    }
+    return result;
+}();
+
+/// @brief Returns the prefix of sortable text with one non-negative digit.
+/// Non-negative numbers with `n` digits have the prefix `center + n - 1`,
+/// and negative numbers have the prefix `center - n`.
+/// The center is `'P'`, so that the prefix is printable for any base with at most 46 digits,
+/// i.e. every base from 7 upwards, and otherwise it is the greatest number of digits,
+/// so that all prefixes fit into a byte.
+[[nodiscard]]
+constexpr int sortable_center(const int base)
+{
+    return std::max(int('P'), u128_max_digits_table[std::size_t(base)]);
+}
+
+/// @brief Writes the prefix and the digits of `magnitude`,
+/// which are complemented (`d` becomes `base - 1 - d`) for negative numbers,
+/// so that larger magnitudes sort first.
+constexpr std::to_chars_result to_chars_sortable_magnitude(
+    char* const first, //
+    char* const last,
+    const uint128_t magnitude,
+    const bool negative,
+    const int base
+)
+{
+    CHARCONV_EXT_ASSERT(first);
+    CHARCONV_EXT_ASSERT(last);
+    CHARCONV_EXT_ASSERT(base >= 2);
+    CHARCONV_EXT_ASSERT(base <= 36);
+
+    if (first == last) {
+        return { last, std::errc::value_too_large };
+    }
+    const std::to_chars_result result
+        = to_chars_128<backend::automatic>(first + 1, last, magnitude, base);
+    if (result.ec != std::errc {}) {
+        return result;
+    }
+
+    const auto length = int(result.ptr - (first + 1));
+    const int center = sortable_center(base);
+    if (negative) {
+        *first = char(center - length);
+        for (char* p = first + 1; p != result.ptr; ++p) {
+            *p = digit_chars[base - 1 - digit_value(*p)];
+        }
+    }
+    else {
+        *first = char(center + length - 1);
+    }
+    return result;
+}
+
+/// @brief Parses the prefix and the digits written by `to_chars_sortable_magnitude`.
+/// Only the canonical encoding is accepted, i.e. there are no leading zeros, no negative zero,
+/// and no uppercase letters.
+constexpr std::from_chars_result from_chars_sortable_magnitude(
+    const char* const first, //
+    const char* const last,
+    uint128_t& magnitude,
+    bool& negative,
+    const int base
+)
+{
+    CHARCONV_EXT_ASSERT(first);
+    CHARCONV_EXT_ASSERT(last);
+    CHARCONV_EXT_ASSERT(base >= 2);
+    CHARCONV_EXT_ASSERT(base <= 36);
+
+    if (first == last) {
+        return { first, std::errc::invalid_argument };
+    }
+    const int center = sortable_center(base);
+    const int prefix = static_cast<unsigned char>(*first);
+    const bool is_negative = prefix < center;
+    const int length = is_negative ? center - prefix : prefix - center + 1;
+    if (length > u128_max_digits_table[std::size_t(base)] || last - first - 1 < length) {
+        return { first, std::errc::invalid_argument };
+    }
+
+    const char* const digits_first = first + 1;
+    const char* const digits_last = digits_first + length;
+    const char zero_digit = digit_chars[is_negative ? base - 1 : 0];
+    if (length > 1 && *digits_first == zero_digit) {
+        return { first, std::errc::invalid_argument };
+    }
+    const auto is_upper = [](const char c) { return c >= 'A' && c <= 'Z'; };
+    if (base > 10 && std::any_of(digits_first, digits_last, is_upper)) {
+        return { first, std::errc::invalid_argument };
+    }
+
+    std::from_chars_result result;
+    if (is_negative) {
+        char digits[128];
+        for (int i = 0; i < length; ++i) {
+            const int value = digit_value(digits_first[i]);
+            if (value < 0 || value >= base) {
+                return { first, std::errc::invalid_argument };
+            }
+            digits[i] = digit_chars[base - 1 - value];
+        }
+        result = from_chars_128<backend::automatic>(digits, digits + length, magnitude, base);
+        if (result.ec == std::errc {} && magnitude == 0) {
+            return { first, std::errc::invalid_argument };
+        }
+    }
+    else {
+        result = from_chars_128<backend::automatic>(digits_first, digits_last, magnitude, base);
+        if (result.ptr != digits_last) {
+            return { first, std::errc::invalid_argument };
+        }
+    }
+    negative = is_negative;
+    return { digits_last, result.ec };
+}
+
+} // namespace detail
+
+/// @brief Writes `value` as sortable text, which is a one-character prefix for the sign
+/// and the number of digits, followed by the digits without leading zeros,
+/// where the digits of negative numbers are complemented (`d` becomes `base - 1 - d`).
+/// Comparing such texts byte by byte (as `unsigned char`, like `memcmp`)
+/// gives the same order as comparing the values, as long as they have the same base.
+/// The prefix is printable ASCII for bases from 7 upwards.
+constexpr std::to_chars_result
+to_chars_sortable(char* const first, char* const last, const uint128_t value, const int base = 10)
+{
+    return detail::to_chars_sortable_magnitude(first, last, value, false, base);
+}
+
+constexpr std::to_chars_result
+to_chars_sortable(char* const first, char* const last, const int128_t value, const int base = 10)
+{
+    const uint128_t magnitude = value < 0 ? -uint128_t(value) : uint128_t(value);
+    return detail::to_chars_sortable_magnitude(first, last, magnitude, value < 0, base);
+}
+
+/// @brief Parses text written by `to_chars_sortable`.
+/// Non-canonical text, such as digits with leading zeros, is an `std::errc::invalid_argument`.
+/// Values which are not representable, including negative values for unsigned integers,
+/// are an `std::errc::result_out_of_range`.
+constexpr std::from_chars_result from_chars_sortable(
+    const char* const first, //
+    const char* const last,
+    uint128_t& value,
+    const int base = 10
+)
+{
+    uint128_t magnitude {};
+    bool negative = false;
+    std::from_chars_result result
+        = detail::from_chars_sortable_magnitude(first, last, magnitude, negative, base);
+    if (result.ec == std::errc {} && negative) {
+        result.ec = std::errc::result_out_of_range;
+    }
+    if (result.ec == std::errc {}) {
+        value = magnitude;
+    }
+    return result;
+}
+
+constexpr std::from_chars_result from_chars_sortable(
+    const char* const first, //
+    const char* const last,
+    int128_t& value,
+    const int base = 10
+)
+{
+    uint128_t magnitude {};
+    bool negative = false;
+    std::from_chars_result result
+        = detail::from_chars_sortable_magnitude(first, last, magnitude, negative, base);
+    if (result.ec == std::errc {} && magnitude > (uint128_t { 1 } << 127) - !negative) {
+        result.ec = std::errc::result_out_of_range;
+    }
+    if (result.ec == std::errc {}) {
+        value = int128_t(negative ? -magnitude : magnitude);
+    }
+    return result;
+}
+
+#ifdef CHARCONV_EXT_BITINT_MAXWIDTH
+template <std::size_t N>
+constexpr std::to_chars_result to_chars_sortable(
+    char* const first, //
+    char* const last,
+    const bit_int<N> value,
+    const int base = 10
+)
+{
+    static_assert(N <= 128, "Sorry, _BitInt(129) and wider not implemented :(");
+    return to_chars_sortable(first, last, int128_t { value }, base);
+}
+
+template <std::size_t N>
+constexpr std::to_chars_result to_chars_sortable(
+    char* const first, //
+    char* const last,
+    const bit_uint<N> value,
+    const int base = 10
+)
+{
+    static_assert(N <= 128, "Sorry, _BitInt(129) and wider not implemented :(");
+    return to_chars_sortable(first, last, uint128_t { value }, base);
+}
+
+template <std::size_t N>
+constexpr std::from_chars_result from_chars_sortable(
+    const char* const first, //
+    const char* const last,
+    bit_int<N>& value,
+    const int base = 10
+)
+{
+    static_assert(N <= 128, "Sorry, _BitInt(129) and wider not implemented :(");
+    int128_t wide {};
+    std::from_chars_result result = from_chars_sortable(first, last, wide, base);
+    if (result.ec == std::errc {}) {
+        if (static_cast<bit_int<N>>(wide) != wide) {
+            result.ec = std::errc::result_out_of_range;
+        }
+        else {
+            value = static_cast<bit_int<N>>(wide);
+        }
+    }
+    return result;
+}
+
+template <std::size_t N>
+constexpr std::from_chars_result from_chars_sortable(
+    const char* const first, //
+    const char* const last,
+    bit_uint<N>& value,
+    const int base = 10
+)
+{
+    static_assert(N <= 128, "Sorry, _BitInt(129) and wider not implemented :(");
+    uint128_t wide {};
+    std::from_chars_result result = from_chars_sortable(first, last, wide, base);
+    if (result.ec == std::errc {}) {
+        if (static_cast<bit_uint<N>>(wide) != wide) {
+            result.ec = std::errc::result_out_of_range;
+        }
+        else {
+            value = static_cast<bit_uint<N>>(wide);
+        }
+    }
+    return result;
+}
+#endif
+
+namespace detail {
+
+/// @brief Returns a `uint128_t` with the lowest `bits` bits set, where `bits <= 128`.
+[[nodiscard]]
+constexpr uint128_t low_mask(const int bits)
+{
+    CHARCONV_EXT_ASSERT(bits >= 0);
+    CHARCONV_EXT_ASSERT(bits <= 128);
+    return bits == 128 ? uint128_t(-1) : (uint128_t { 1 } << bits) - 1;
+}
+
+/// @brief Returns the number of trailing zero bits in `x`, which must not be zero.
+[[nodiscard]]
+constexpr int countr_zero(const uint128_t x)
+{
+    CHARCONV_EXT_ASSERT(x != 0);
+    const auto lo = std::uint64_t(x);
+    return lo != 0 ? std::countr_zero(lo) : 64 + std::countr_zero(std::uint64_t(x >> 64));
+}
+
+/// @brief Multiplies the binary fraction `fraction / pow(2, fraction_bits)` by `factor`,
+/// stores the new fractional part in `fraction`, and returns the integer part.
+/// For `factor == pow(10, k)`, this moves the next `k` decimal digits into the integer part.
+/// The product has up to 192 bits, so it is computed with two 64x64-bit multiplications.
+[[nodiscard]]
+constexpr std::uint64_t
+multiply_fraction(uint128_t& fraction, const int fraction_bits, const std::uint64_t factor)
+{
+    CHARCONV_EXT_ASSERT(fraction_bits >= 1);
+    CHARCONV_EXT_ASSERT(fraction_bits <= 128);
+
+    const uint128_t lo = uint128_t(std::uint64_t(fraction)) * factor;
+    const uint128_t hi = uint128_t(std::uint64_t(fraction >> 64)) * factor + (lo >> 64);
+    const auto lo_64 = std::uint64_t(lo);
+
+    if (fraction_bits == 64) {
+        fraction = lo_64;
+        return std::uint64_t(hi);
+    }
+    if (fraction_bits < 64) {
+        fraction = lo_64 & std::uint64_t(low_mask(fraction_bits));
+        return std::uint64_t(hi << (64 - fraction_bits)) | (lo_64 >> fraction_bits);
+    }
+    fraction = ((hi & low_mask(fraction_bits - 64)) << 64) | lo_64;
+    return std::uint64_t(hi >> (fraction_bits - 64));
+}
+
+/// @brief Implements `to_chars_fixed_point` for the magnitude of a fixed-point number.
+constexpr std::to_chars_result to_chars_fixed_point_magnitude(
+    char* const first, //
+    char* const last,
+    const uint128_t magnitude,
+    const int fraction_bits,
+    const int precision
+)
+{
+    const uint128_t integer = fraction_bits == 128 ? 0 : magnitude >> fraction_bits;
+    uint128_t fraction = magnitude & low_mask(fraction_bits);
+
+    if (precision == 0 && fraction_bits != 0) {
+        const uint128_t half = uint128_t { 1 } << (fraction_bits - 1);
+        const bool round_up = fraction > half || (fraction == half && (integer & 1));
+        return to_chars_any(first, last, integer + round_up, 10);
+    }
+    const std::to_chars_result integer_result = to_chars_any(first, last, integer, 10);
+    if (integer_result.ec != std::errc {} || precision == 0 || (precision < 0 && fraction == 0)) {
+        return integer_result;
+    }
+    // The exact decimal expansion of a binary fraction with n significant bits
+    // has exactly n digits, and no rounding is needed to print all of them.
+    const int digits = precision >= 0 ? precision : fraction_bits - countr_zero(fraction);
+
+    char* const point = integer_result.ptr;
+    if (last - point < 1 + digits) {
+        return { last, std::errc::value_too_large };
+    }
+    *point = '.';
+
+    constexpr int chunk_digits = 19;
+    char* current = point + 1;
+    char* const fraction_last = current + digits;
+    while (current != fraction_last) {
+        if (fraction == 0) {
+            std::ranges::fill(current, fraction_last, '0');
+            return { fraction_last, std::errc {} };
+        }
+        const int length = int(std::min(fraction_last - current, std::ptrdiff_t(chunk_digits)));
+        const std::uint64_t chunk
+            = multiply_fraction(fraction, fraction_bits, u64_pow10_table[std::size_t(length)]);
+        write_u64_digits(current, chunk, length, 10);
+        current += length;
+    }
+
+    // Round half to even, based on the remaining fraction.
+    const uint128_t half = uint128_t { 1 } << (fraction_bits - 1);
+    const bool odd = (fraction_last[-1] - '0') % 2 != 0;
+    if (fraction < half || (fraction == half && !odd)) {
+        return { fraction_last, std::errc {} };
+    }
+    for (char* p = fraction_last - 1; p != point; --p) {
+        if (*p != '9') {
+            ++*p;
+            return { fraction_last, std::errc {} };
+        }
+        *p = '0';
+    }
+    // The carry propagated into the integer part, and all fractional digits are zero now.
+    const std::to_chars_result carry_result = to_chars_any(first, last, integer + 1, 10);
+    if (carry_result.ec != std::errc {} || last - carry_result.ptr < 1 + digits) {
+        return { last, std::errc::value_too_large };
+    }
+    *carry_result.ptr = '.';
+    std::ranges::fill_n(carry_result.ptr + 1, digits, '0');
+    return { carry_result.ptr + 1 + digits, std::errc {} };
+}
+
+/// @brief Converts the decimal fraction digits in `[first, last)` to a binary fraction
+/// with `fraction_bits` bits, rounded to nearest, ties to even.
+/// Returns `true` if the result rounds up to `pow(2, fraction_bits)`,
+/// in which case `out` is zero.
+///
+/// The digits are stored as base-`pow(10, 18)` limbs, most significant first,
+/// and every doubling of those limbs shifts the next bit into the integer part.
+/// Only the first `fraction_bits + 1` digits can influence the result,
+/// beyond those, it only matters whether any digit is nonzero.
+[[nodiscard]]
+constexpr bool parse_binary_fraction(
+    const char* const first, //
+    const char* const last,
+    uint128_t& out,
+    const int fraction_bits
+)
+{
+    constexpr int chunk_digits = 19;
+    const auto digits = std::ptrdiff_t(fraction_bits) + 1;
+    const char* const significant_last = first + std::min(last - first, digits);
+    const bool sticky = std::any_of(significant_last, last, [](char c) { return c != '0'; });
+
+    if (fraction_bits <= 64 && significant_last - first <= chunk_digits) {
+        // Fast path for common formats like Q64.64: one division yields the entire fraction.
+        const auto length = int(significant_last - first);
+        const std::uint64_t numerator = parse_u64_digits(first, length, 10);
+        const std::uint64_t denominator = u64_pow10_table[std::size_t(length)];
+        const uint128_t scaled = uint128_t(numerator) << fraction_bits;
+        const uint128_t quotient = scaled / denominator;
+        const auto remainder = std::uint64_t(scaled % denominator);
+        const uint128_t twice_remainder = uint128_t(remainder) * 2;
+        const bool round_up = twice_remainder > denominator
+            || (twice_remainder == denominator && (sticky || (quotient & 1)));
+        out = (quotient + round_up) & low_mask(fraction_bits);
+        return (quotient + round_up) >> fraction_bits != 0;
+    }
+
+    // Limbs hold 18 rather than 19 digits, so that doubling them cannot overflow.
+    constexpr int limb_digits = 18;
+    constexpr std::uint64_t limb_base = u64_pow10_table[limb_digits];
+    std::uint64_t limbs[(128 + 1 + limb_digits - 1) / limb_digits] {};
+    std::size_t limb_count = 0;
+    for (const char* p = first; p < significant_last; p += limb_digits) {
+        const auto length = int(std::min(significant_last - p, std::ptrdiff_t(limb_digits)));
+        limbs[limb_count++] = parse_u64_digits(p, length, 10)
+            * u64_pow10_table[std::size_t(limb_digits - length)];
+    }
+
+    const auto double_limbs = [&] {
+        bool carry = false;
+        for (std::size_t i = limb_count; i-- != 0;) {
+            const std::uint64_t twice = limbs[i] * 2 + carry;
+            carry = twice >= limb_base;
+            limbs[i] = carry ? twice - limb_base : twice;
+        }
+        return carry;
+    };
+
+    uint128_t result = 0;
+    for (int i = 0; i < fraction_bits; ++i) {
+        result = (result << 1) | uint128_t(double_limbs());
+    }
+    const bool round_bit = double_limbs();
+    const bool rest
+        = sticky || std::any_of(limbs, limbs + limb_count, [](std::uint64_t l) { return l != 0; });
+    if (round_bit && (rest || (result & 1))) {
+        ++result;
+        if ((result & low_mask(fraction_bits)) == 0) {
+            out = 0;
+            return true;
+        }
+    }
+    out = result;
+    return false;
+}
+
+/// @brief Implements `from_chars_fixed_point` for the magnitude of a fixed-point number.
+constexpr std::from_chars_result from_chars_fixed_point_magnitude(
+    const char* const first, //
+    const char* const last,
+    uint128_t& out,
+    const int fraction_bits,
+    const uint128_t limit
+)
+{
+    uint128_t integer {};
+    const std::from_chars_result integer_result = from_chars_any(first, last, integer, 10);
+    if (integer_result.ec == std::errc::invalid_argument) {
+        return integer_result;
+    }
+
+    const char* ptr = integer_result.ptr;
+    uint128_t fraction = 0;
+    bool carry = false;
+    if (last - ptr >= 2 && *ptr == '.' && digit_value(ptr[1]) >= 0 && digit_value(ptr[1]) < 10) {
+        const char* const fraction_first = ptr + 1;
+        ptr = fraction_first + pattern_length(fraction_first, last, 10);
+        if (fraction_bits != 0) {
+            carry = parse_binary_fraction(fraction_first, ptr, fraction, fraction_bits);
+        }
+        else {
+            // Without fractional bits, we only need to round to the nearest integer.
+            const char first_digit = *fraction_first;
+            const bool rest
+                = std::any_of(fraction_first + 1, ptr, [](char c) { return c != '0'; });
+            carry = first_digit > '5' || (first_digit == '5' && (rest || (integer & 1)));
+        }
+    }
+
+    if (integer_result.ec != std::errc {} || integer > low_mask(128 - fraction_bits)) {
+        return { ptr, std::errc::result_out_of_range };
+    }
+    uint128_t result = (fraction_bits == 128 ? 0 : integer << fraction_bits) | fraction;
+    if (carry && fraction_bits == 128) {
+        return { ptr, std::errc::result_out_of_range };
+    }
+    if (carry && add_overflow(result, result, uint128_t { 1 } << fraction_bits)) {
+        return { ptr, std::errc::result_out_of_range };
+    }
+    if (result > limit) {
+        return { ptr, std::errc::result_out_of_range };
+    }
+    out = result;
+    return { ptr, std::errc {} };
+}
+
+} // namespace detail
+
+/// @brief Converts the binary fixed-point number `value / pow(2, fraction_bits)` to decimal.
+/// If `precision` is negative, the exact decimal expansion is printed,
+/// otherwise exactly `precision` fractional digits, correctly rounded (half to even).
+constexpr std::to_chars_result to_chars_fixed_point(
+    char* const first, //
+    char* const last,
+    const uint128_t value,
+    const int fraction_bits,
+    const int precision = -1
+)
+{
+    CHARCONV_EXT_ASSERT(first);
+    CHARCONV_EXT_ASSERT(last);
+    CHARCONV_EXT_ASSERT(fraction_bits >= 0);
+    CHARCONV_EXT_ASSERT(fraction_bits <= 128);
+
+    return detail::to_chars_fixed_point_magnitude(first, last, value, fraction_bits, precision);
+}
+
+constexpr std::to_chars_result to_chars_fixed_point(
+    char* const first, //
+    char* const last,
+    const int128_t value,
+    const int fraction_bits,
+    const int precision = -1
+)
+{
+    CHARCONV_EXT_ASSERT(first);
+    CHARCONV_EXT_ASSERT(last);
+    CHARCONV_EXT_ASSERT(fraction_bits >= 0);
+    CHARCONV_EXT_ASSERT(fraction_bits <= 127);
+
+    if (value >= 0) {
+        return detail::to_chars_fixed_point_magnitude(
+            first, last, uint128_t(value), fraction_bits, precision
+        );
+    }
+    if (first == last) {
+        return { last, std::errc::value_too_large };
+    }
+    *first = '-';
+    return detail::to_chars_fixed_point_magnitude(
+        first + 1, last, -uint128_t(value), fraction_bits, precision
+    );
+}
+
+/// @brief Parses a decimal number of the form `123` or `123.456` into a binary fixed-point
+/// number with `fraction_bits` fractional bits, correctly rounded (half to even).
+constexpr std::from_chars_result from_chars_fixed_point(
+    const char* const first, //
+    const char* const last,
+    uint128_t& value,
+    const int fraction_bits
+)
+{
+    CHARCONV_EXT_ASSERT(first);
+    CHARCONV_EXT_ASSERT(last);
+    CHARCONV_EXT_ASSERT(fraction_bits >= 0);
+    CHARCONV_EXT_ASSERT(fraction_bits <= 128);
+
+    return detail::from_chars_fixed_point_magnitude(
+        first, last, value, fraction_bits, uint128_t(-1)
+    );
+}
+
+constexpr std::from_chars_result from_chars_fixed_point(
+    const char* const first, //
+    const char* const last,
+    int128_t& value,
+    const int fraction_bits
+)
+{
+    CHARCONV_EXT_ASSERT(first);
+    CHARCONV_EXT_ASSERT(last);
+    CHARCONV_EXT_ASSERT(fraction_bits >= 0);
+    CHARCONV_EXT_ASSERT(fraction_bits <= 127);
+
+    const bool negative = first != last && *first == '-';
+    const uint128_t limit = (uint128_t { 1 } << 127) - !negative;
+
+    uint128_t magnitude {};
+    const std::from_chars_result result = detail::from_chars_fixed_point_magnitude(
+        first + negative, last, magnitude, fraction_bits, limit
+    );
+    if (result.ec == std::errc::invalid_argument) {
+        return { first, result.ec };
+    }
+    if (result.ec == std::errc {}) {
+        value = int128_t(negative ? -magnitude : magnitude);
+    }
+    return result;
+}
+
+namespace detail {
+
+/// @brief A positive, finite binary floating-point value `significand * pow(2, exponent)`,
+/// where `significand` is odd.
+struct float_decomposition {
+    uint128_t significand;
+    int exponent;
+};
+
+template <typename T>
+[[nodiscard]]
+float_decomposition decompose_float(const T magnitude)
+{
+    constexpr int digits = std::numeric_limits<T>::digits;
+    static_assert(std::numeric_limits<T>::radix == 2);
+    static_assert(digits <= 128);
+
+    int exponent = 0;
+    const T normalized = std::frexp(magnitude, &exponent);
+    // normalized is in [0.5, 1) and has at most `digits` significant bits,
+    // so scaling it by pow(2, digits) yields an integer exactly.
+    const auto significand = uint128_t(std::ldexp(normalized, digits));
+    const int zeros = countr_zero(significand);
+    return { significand >> zeros, exponent - digits + zeros };
+}
+
+/// @brief Converts the little-endian 64-bit limbs `[limbs, limbs + size)` to base `pow(10, 19)`
+/// by repeated division, and stores the digits in `chunks`, least significant first.
+/// The limbs are destroyed. Returns the number of chunks.
+[[nodiscard]]
+inline std::size_t
+limbs_to_decimal_chunks(std::uint64_t* const limbs, std::size_t size, std::uint64_t* const chunks)
+{
+    const divider<std::uint64_t>& d = u64_max_power_dividers[10];
+    std::size_t count = 0;
+    while (size != 0 && limbs[size - 1] == 0) {
+        --size;
+    }
+    while (size != 0) {
+        std::uint64_t remainder = 0;
+        for (std::size_t i = size; i-- != 0;) {
+            const auto [quotient, r] = d.divmod(uint128_t(remainder) << 64 | limbs[i]);
+            limbs[i] = std::uint64_t(quotient);
+            remainder = r;
+        }
+        chunks[count++] = remainder;
+        size -= limbs[size - 1] == 0;
+    }
+    return count;
+}
+
+/// @brief The binary fraction `numerator / pow(2, bits)`, stored in `Limbs` 64-bit limbs,
+/// whose decimal digits are extracted by repeated multiplication with powers of ten.
+/// Only the range of limbs which are not zero is multiplied, which keeps long runs
+/// of leading or trailing zeros (as in subnormal numbers) cheap.
+template <std::size_t Limbs>
+class binary_fraction {
+public:
+    binary_fraction(const uint128_t numerator, const int bits)
+        : m_size(std::size_t(bits + 63) / 64)
+    {
+        CHARCONV_EXT_ASSERT(bits >= 0);
+        CHARCONV_EXT_ASSERT(m_size <= Limbs);
+
+        // Align the fraction to a whole number of limbs.
+        const auto shift = int(64 * m_size) - bits;
+        const uint128_t shifted = numerator << shift;
+        const std::uint64_t words[]
+            = { std::uint64_t(shifted),
+                std::uint64_t(shifted >> 64),
+                shift == 0 ? 0 : std::uint64_t(numerator >> (128 - shift)) };
+        for (std::size_t i = 0; i < std::min(m_size, std::size(words)); ++i) {
+            m_limbs[i] = words[i];
+            m_high = words[i] != 0 ? i + 1 : m_high;
+        }
+        while (m_low != m_high && m_limbs[m_low] == 0) {
+            ++m_low;
+        }
+    }
+
+    /// @brief Multiplies the fraction by `factor`, keeps the fractional part,
+    /// and returns the integer part.
+    [[nodiscard]]
+    std::uint64_t next(const std::uint64_t factor)
+    {
+        std::uint64_t carry = 0;
+        for (std::size_t i = m_low; i < m_high; ++i) {
+            const uint128_t product = uint128_t(m_limbs[i]) * factor + carry;
+            m_limbs[i] = std::uint64_t(product);
+            carry = std::uint64_t(product >> 64);
+        }
+        if (m_high != m_size && carry != 0) {
+            m_limbs[m_high++] = carry;
+            carry = 0;
+        }
+        while (m_low != m_high && m_limbs[m_low] == 0) {
+            ++m_low;
+        }
+        return carry;
+    }
+
+private:
+    std::array<std::uint64_t, Limbs> m_limbs {};
+    std::size_t m_size;
+    std::size_t m_low = 0;
+    std::size_t m_high = 0;
+};
+
+/// @brief Writes the most significant `std::min(length, last - current)` digits
+/// of the `length`-digit decimal number `chunk` to `current`, and advances it.
+inline void write_clipped_digits(
+    char*& current, //
+    char* const last,
+    const std::uint64_t chunk,
+    const int length
+)
+{
+    const int kept = int(std::min(std::ptrdiff_t(length), last - current));
+    write_u64_digits(current, chunk / u64_pow10_table[std::size_t(length - kept)], kept, 10);
+    current += kept;
+}
+
+/// @brief Implements `to_chars_exact` for a positive, finite, nonzero value.
+template <typename T>
+std::to_chars_result to_chars_exact_magnitude(
+    char* const first, //
+    char* const last,
+    const T magnitude,
+    const std::chars_format fmt
+)
+{
+    using limits = std::numeric_limits<T>;
+    constexpr int chunk_digits = 19;
+    constexpr std::size_t integer_limbs = std::size_t(limits::max_exponent + 63) / 64 + 2;
+    // log10(2) is approximately 1233 / 4096.
+    constexpr auto max_integer_digits = std::size_t(limits::max_exponent * 1233 / 4096 + 1);
+    constexpr std::size_t max_chunks = max_integer_digits / chunk_digits + 1;
+    constexpr auto max_fraction_bits = std::size_t(limits::digits - limits::min_exponent);
+    constexpr std::size_t fraction_limbs = (max_fraction_bits + 63) / 64;
+
+    const auto [significand, exponent] = decompose_float(magnitude);
+
+    // Split the value into an integer and a fraction with `fraction_bits` bits.
+    // Since the significand is odd, the fraction has exactly `fraction_bits` decimal digits.
+    std::array<std::uint64_t, integer_limbs> limbs {};
+    const int fraction_bits = std::max(-exponent, 0);
+    uint128_t fraction = 0;
+    if (exponent >= 0) {
+        const auto index = std::size_t(exponent / 64);
+        const int shift = exponent % 64;
+        limbs[index] = std::uint64_t(significand << shift);
+        limbs[index + 1] = std::uint64_t((significand << shift) >> 64);
+        limbs[index + 2] = shift == 0 ? 0 : std::uint64_t(significand >> (128 - shift));
+    }
+    else {
+        const uint128_t integer = fraction_bits >= 128 ? 0 : significand >> fraction_bits;
+        fraction = significand & low_mask(std::min(fraction_bits, 128));
+        limbs[0] = std::uint64_t(integer);
+        limbs[1] = std::uint64_t(integer >> 64);
+    }
+
+    std::array<std::uint64_t, max_chunks> chunks;
+    const std::size_t chunk_count
+        = limbs_to_decimal_chunks(limbs.data(), limbs.size(), chunks.data());
+    const std::size_t tail_chunks = chunk_count == 0 ? 0 : chunk_count - 1;
+    const int head_length = chunk_count == 0 ? 0 : u64_digit_count(chunks[tail_chunks], 10);
+    const int integer_digits = head_length + int(tail_chunks) * chunk_digits;
+
+    char* current = first;
+    const auto write_integer = [&](char* const end) {
+        if (chunk_count != 0) {
+            write_clipped_digits(current, end, chunks[tail_chunks], head_length);
+        }
+        for (std::size_t i = tail_chunks; i-- != 0 && current != end;) {
+            write_clipped_digits(current, end, chunks[i], chunk_digits);
+        }
+    };
+    binary_fraction<fraction_limbs> expansion(fraction, fraction_bits);
+    int fraction_remaining = fraction_bits;
+    const auto next_fraction_chunk = [&](int& length) {
+        length = std::min(fraction_remaining, chunk_digits);
+        fraction_remaining -= length;
+        return expansion.next(u64_pow10_table[std::size_t(length)]);
+    };
+
+    if (fmt == std::chars_format::fixed) {
+        const int length = std::max(integer_digits, 1) + (fraction_bits != 0) + fraction_bits;
+        if (last - first < length) {
+            return { last, std::errc::value_too_large };
+        }
+        if (integer_digits == 0) {
+            *current++ = '0';
+        }
+        write_integer(last);
+        if (fraction_bits != 0) {
+            *current++ = '.';
+        }
+        while (fraction_remaining != 0) {
+            int chunk_length = 0;
+            const std::uint64_t chunk = next_fraction_chunk(chunk_length);
+            write_u64_digits(current, chunk, chunk_length, 10);
+            current += chunk_length;
+        }
+        return { current, std::errc {} };
+    }
+
+    // In scientific notation, leading zeros of the fraction are skipped (if the integer is zero),
+    // and trailing zeros of the integer are dropped (if there is no fraction).
+    int significant_digits = integer_digits + fraction_bits;
+    int decimal_exponent = integer_digits - 1;
+    std::uint64_t first_chunk = 0;
+    int first_chunk_length = 0;
+    if (integer_digits == 0) {
+        int leading_zeros = 0;
+        while ((first_chunk = next_fraction_chunk(first_chunk_length)) == 0) {
+            leading_zeros += first_chunk_length;
+        }
+        const int first_chunk_digits = u64_digit_count(first_chunk, 10);
+        leading_zeros += first_chunk_length - first_chunk_digits;
+        first_chunk_length = first_chunk_digits;
+        significant_digits -= leading_zeros;
+        decimal_exponent = -leading_zeros - 1;
+    }
+    else if (fraction_bits == 0) {
+        std::size_t i = 0;
+        for (; chunks[i] == 0; ++i) {
+            significant_digits -= chunk_digits;
+        }
+        for (std::uint64_t low = chunks[i]; low % 10 == 0; low /= 10) {
+            --significant_digits;
+        }
+    }
+
+    const std::uint64_t exponent_magnitude = std::uint64_t(std::abs(decimal_exponent));
+    const int exponent_digits = std::max(u64_digit_count(exponent_magnitude, 10), 2);
+    const int length = significant_digits + (significant_digits > 1) + 2 + exponent_digits;
+    if (last - first < length) {
+        return { last, std::errc::value_too_large };
+    }
+    // The digits are written one position to the right, and then the first digit
+    // is moved in front of the decimal point.
+    char* const mantissa_last = first + 1 + significant_digits;
+    current = first + 1;
+    write_integer(mantissa_last);
+    if (first_chunk_length != 0) {
+        write_clipped_digits(current, mantissa_last, first_chunk, first_chunk_length);
+    }
+    while (current != mantissa_last) {
+        int chunk_length = 0;
+        const std::uint64_t chunk = next_fraction_chunk(chunk_length);
+        write_clipped_digits(current, mantissa_last, chunk, chunk_length);
+    }
+    first[0] = first[1];
+    first[1] = '.';
+    current = significant_digits > 1 ? mantissa_last : first + 1;
+    *current++ = 'e';
+    *current++ = decimal_exponent < 0 ? '-' : '+';
+    write_u64_digits(current, exponent_magnitude, exponent_digits, 10);
+    return { current + exponent_digits, std::errc {} };
+}
+
+template <typename T>
+std::to_chars_result
+to_chars_exact_impl(char* first, char* const last, const T value, const std::chars_format fmt)
+{
+    CHARCONV_EXT_ASSERT(first);
+    CHARCONV_EXT_ASSERT(last);
+    CHARCONV_EXT_ASSERT(fmt == std::chars_format::fixed || fmt == std::chars_format::scientific);
+
+    if (std::signbit(value)) {
+        if (first == last) {
+            return { last, std::errc::value_too_large };
+        }
+        *first++ = '-';
+    }
+    const auto write_text = [&](const std::string_view text) -> std::to_chars_result {
+        if (last - first < std::ptrdiff_t(text.size())) {
+            return { last, std::errc::value_too_large };
+        }
+        return { std::ranges::copy(text, first).out, std::errc {} };
+    };
+    if (std::isnan(value)) {
+        return write_text("nan");
+    }
+    if (std::isinf(value)) {
+        return write_text("inf");
+    }
+    if (value == 0) {
+        return write_text(fmt == std::chars_format::fixed ? "0" : "0e+00");
+    }
+    return to_chars_exact_magnitude(first, last, std::fabs(value), fmt);
+}
+
+} // namespace detail
+
+/// @brief Converts `value` to its exact decimal expansion, with every significant digit,
+/// in `std::chars_format::fixed` or `std::chars_format::scientific` notation.
+/// Unlike `std::to_chars`, the output does not round-trip with as few digits as possible,
+/// but is the precise value of the binary floating-point number.
+/// Infinity and NaN are formatted like `std::to_chars` does.
+inline std::to_chars_result to_chars_exact(
+    char* const first, //
+    char* const last,
+    const double value,
+    const std::chars_format fmt = std::chars_format::fixed
+)
+{
+    return detail::to_chars_exact_impl(first, last, value, fmt);
+}
+
+inline std::to_chars_result to_chars_exact(
+    char* const first, //
+    char* const last,
+    const long double value,
+    const std::chars_format fmt = std::chars_format::fixed
+)
+{
+    return detail::to_chars_exact_impl(first, last, value, fmt);
+}
+
+namespace detail {
+
+/// @brief The integer type which holds a single `N`-bit element of a packed array
+/// while it is being converted.
+template <std::size_t N, bool Signed>
+using packed_element_t = std::conditional_t<
+    (N <= 64),
+    std::conditional_t<Signed, std::int64_t, std::uint64_t>,
+    std::conditional_t<Signed, int128_t, uint128_t>>;
+
+/// @brief Returns `true` if `x` is representable as an `N`-bit integer
+/// of the same signedness as `T`.
+template <std::size_t N, typename T>
+[[nodiscard]]
+constexpr bool fits_in_bits(const T x)
+{
+    if constexpr (N >= sizeof(T) * CHAR_BIT) {
+        return true;
+    }
+    else if constexpr (is_signed_integer<T>) {
+        return x >= -(T(1) << (N - 1)) && x < (T(1) << (N - 1));
+    }
+    else {
+        return (x >> N) == 0;
+    }
+}
+
+/// @brief Appends integers of up to 128 bits to a little-endian bit stream,
+/// where bit `i` of the stream is bit `i % 8` of byte `i / 8`.
+/// Complete bytes are stored as soon as they are known,
+/// so the output does not have to be zero-initialized.
+class packed_bit_writer {
+public:
+    constexpr explicit packed_bit_writer(std::byte* const out)
+        : m_out(out)
+    {
+    }
+
+    /// @brief Appends the lowest `n` bits of `bits`, where the other bits must be zero.
+    constexpr void write(const uint128_t bits, const std::size_t n)
+    {
+        write_64(std::uint64_t(bits), std::min(n, std::size_t(64)));
+        if (n > 64) {
+            write_64(std::uint64_t(bits >> 64), n - 64);
+        }
+    }
+
+    /// @brief Stores the final, incomplete byte, if any, with its unused bits cleared.
+    constexpr void flush()
+    {
+        if (m_pending_bits != 0) {
+            *m_out++ = std::byte(m_pending);
+            m_pending = 0;
+            m_pending_bits = 0;
+        }
+    }
+
+private:
+    std::byte* m_out;
+    // Fewer than eight bits are pending between calls, so up to 71 bits are held at once.
+    uint128_t m_pending = 0;
+    std::size_t m_pending_bits = 0;
+
+    constexpr void write_64(const std::uint64_t bits, const std::size_t n)
+    {
+        m_pending |= uint128_t(bits) << m_pending_bits;
+        m_pending_bits += n;
+        for (; m_pending_bits >= 8; m_pending_bits -= 8) {
+            *m_out++ = std::byte(m_pending);
+            m_pending >>= 8;
+        }
+    }
+};
+
+/// @brief Reads integers of up to 128 bits from a bit stream written by `packed_bit_writer`.
+/// Bytes are only loaded once they are needed,
+/// so no byte past the end of the last element is accessed.
+class packed_bit_reader {
+public:
+    constexpr explicit packed_bit_reader(const std::byte* const in)
+        : m_in(in)
+    {
+    }
+
+    /// @brief Returns the next `n` bits of the stream as an unsigned integer.
+    [[nodiscard]]
+    constexpr uint128_t read(const std::size_t n)
+    {
+        const uint128_t lo = read_64(std::min(n, std::size_t(64)));
+        return n > 64 ? lo | uint128_t(read_64(n - 64)) << 64 : lo;
+    }
+
+private:
+    const std::byte* m_in;
+    uint128_t m_pending = 0;
+    std::size_t m_pending_bits = 0;
+
+    constexpr std::uint64_t read_64(const std::size_t n)
+    {
+        for (; m_pending_bits < n; m_pending_bits += 8) {
+            m_pending |= uint128_t(std::to_integer<std::uint8_t>(*m_in++)) << m_pending_bits;
+        }
+        const std::uint64_t result = std::uint64_t(m_pending & low_mask(int(n)));
+        m_pending >>= n;
+        m_pending_bits -= n;
+        return result;
+    }
+};
+
+} // namespace detail
+
+/// @brief Returns the number of bytes which `count` packed `N`-bit integers occupy.
+template <std::size_t N>
+[[nodiscard]]
+constexpr std::size_t packed_size(const std::size_t count)
+{
+    static_assert(N >= 1 && N <= 128, "Packed integers must have between 1 and 128 bits.");
+    return (count * N + 7) / 8;
+}
+
+/// @brief The result of `from_chars_packed`.
+/// `count` is the number of integers that were stored, even if an error occurred.
+struct from_chars_packed_result {
+    const char* ptr;
+    std::size_t count;
+    std::errc ec;
+};
+
+/// @brief Parses a sequence of integers in `[first, last)` which are separated by `delimiter`,
+/// and stores them as a dense stream of `N`-bit integers in `out`.
+/// Element `i` occupies bits `[i * N, (i + 1) * N)` of the stream,
+/// and bit `j` of the stream is bit `j % 8` of byte `j / 8`.
+/// Signed integers are stored in two's complement.
+///
+/// Parsing stops after the first integer which is not followed by `delimiter`.
+/// Integers which cannot be represented in `N` bits result in `std::errc::result_out_of_range`,
+/// and running out of space in `out` results in `std::errc::value_too_large`.
+template <std::size_t N, bool Signed = false>
+constexpr from_chars_packed_result from_chars_packed(
+    const char* const first, //
+    const char* const last,
+    const char delimiter,
+    const std::span<std::byte> out,
+    const int base = 10
+)
+{
+    static_assert(N >= 1 && N <= 128, "Packed integers must have between 1 and 128 bits.");
+    CHARCONV_EXT_ASSERT(first);
+    CHARCONV_EXT_ASSERT(last);
+    CHARCONV_EXT_ASSERT(base >= 2);
+    CHARCONV_EXT_ASSERT(base <= 36);
+
+    if (first == last) {
+        return { first, 0, std::errc {} };
+    }
+    const std::size_t capacity = out.size() * 8 / N;
+    detail::packed_bit_writer writer { out.data() };
+    std::size_t count = 0;
+    const char* current = first;
+
+    // The parsing and packing happen in the same pass, without intermediate storage.
+    while (true) {
+        if (count == capacity) {
+            writer.flush();
+            return { current, count, std::errc::value_too_large };
+        }
+        detail::packed_element_t<N, Signed> value {};
+        const std::from_chars_result result = detail::from_chars_any(current, last, value, base);
+        if (result.ec == std::errc {} && !detail::fits_in_bits<N>(value)) {
+            writer.flush();
+            return { result.ptr, count, std::errc::result_out_of_range };
+        }
+        if (result.ec != std::errc {}) {
+            writer.flush();
+            return { result.ptr, count, result.ec };
+        }
+        writer.write(uint128_t(value) & detail::low_mask(int(N)), N);
+        ++count;
+
+        current = result.ptr;
+        if (current == last || *current != delimiter) {
+            writer.flush();
+            return { current, count, std::errc {} };
+        }
+        ++current;
+    }
+}
+
+/// @brief Writes the first `count` `N`-bit integers in `packed`,
+/// which are laid out as described for `from_chars_packed`,
+/// separated by `delimiter`.
+template <std::size_t N, bool Signed = false>
+constexpr std::to_chars_result to_chars_packed(
+    char* const first, //
+    char* const last,
+    const std::span<const std::byte> packed,
+    const std::size_t count,
+    const char delimiter,
+    const int base = 10
+)
+{
+    static_assert(N >= 1 && N <= 128, "Packed integers must have between 1 and 128 bits.");
+    CHARCONV_EXT_ASSERT(first);
+    CHARCONV_EXT_ASSERT(last);
+    CHARCONV_EXT_ASSERT(base >= 2);
+    CHARCONV_EXT_ASSERT(base <= 36);
+    CHARCONV_EXT_ASSERT(packed_size<N>(count) <= packed.size());
+
+    detail::packed_bit_reader reader { packed.data() };
+    char* current = first;
+    for (std::size_t i = 0; i < count; ++i) {
+        if (i != 0) {
+            if (current == last) {
+                return { last, std::errc::value_too_large };
+            }
+            *current++ = delimiter;
+        }
+        uint128_t bits = reader.read(N);
+        if constexpr (Signed && N < 128) {
+            // Sign extension
+            if ((bits >> (N - 1)) != 0) {
+                bits |= ~detail::low_mask(int(N));
+            }
+        }
+        const auto value = detail::packed_element_t<N, Signed>(bits);
+        const std::to_chars_result result = detail::to_chars_any(current, last, value, base);
+        if (result.ec != std::errc {}) {
+            return result;
+        }
+        current = result.ptr;
+    }
+    return { current, std::errc {} };
+}
+
+/// @brief Describes one field of a `record`, which holds a `T` in the given `Base`.
+template <typename T, int Base = 10>
+struct field {
+    static_assert(Base >= 2 && Base <= 36, "The base of a field must be in [2, 36].");
+
+    using value_type = T;
+    static constexpr int base = Base;
+};
+
+/// @brief Describes the layout of a line with a fixed sequence of delimited integer fields,
+/// such as `record<field<uint128_t, 16>, field<int128_t>>` for `"ff,-1"`.
+///
+/// The base of each field is passed to the conversion kernels as a template argument,
+/// which select the code for it with `if constexpr`, so there are no checks for it at run time.
+/// The conversions are also flattened, i.e. every call is inlined into them.
+template <typename... Fields>
+struct record {
+    static_assert(sizeof...(Fields) != 0, "A record must have at least one field.");
+
+    using value_type = std::tuple<typename Fields::value_type...>;
+
+    /// @brief Parses the fields, separated by `delimiter`, from `[first, last)`.
+    /// On success, `ptr` points past the last field, and `out` holds the values.
+    /// If a field is not followed by `delimiter`, the result is `std::errc::invalid_argument`,
+    /// with `ptr` pointing to where the delimiter was expected.
+    /// Otherwise, errors are reported like for `from_chars` of the failing field.
+    /// `out` is only modified on success.
+    [[gnu::flatten]]
+    static constexpr std::from_chars_result from_chars(
+        const char* const first, //
+        const char* const last,
+        value_type& out,
+        const char delimiter
+    )
+    {
+        CHARCONV_EXT_ASSERT(first);
+        CHARCONV_EXT_ASSERT(last);
+
+        value_type values {};
+        std::from_chars_result result { first, std::errc {} };
+        [&]<std::size_t... I>(std::index_sequence<I...>) {
+            (parse_field<I>(result, last, values, delimiter) && ...);
+        }(std::index_sequence_for<Fields...> {});
+
+        if (result.ec == std::errc {}) {
+            out = values;
+        }
+        return result;
+    }
+
+    /// @brief Writes the fields of `values`, separated by `delimiter`, to `[first, last)`.
+    [[gnu::flatten]]
+    static constexpr std::to_chars_result to_chars(
+        char* const first, //
+        char* const last,
+        const value_type& values,
+        const char delimiter
+    )
+    {
+        CHARCONV_EXT_ASSERT(first);
+        CHARCONV_EXT_ASSERT(last);
+
+        std::to_chars_result result { first, std::errc {} };
+        [&]<std::size_t... I>(std::index_sequence<I...>) {
+            (format_field<I>(result, last, values, delimiter) && ...);
+        }(std::index_sequence_for<Fields...> {});
+        return result;
+    }
+
+private:
+    template <std::size_t I>
+    using field_at = std::tuple_element_t<I, std::tuple<Fields...>>;
+
+    template <std::size_t I>
+    static constexpr bool parse_field(
+        std::from_chars_result& result, //
+        const char* const last,
+        value_type& values,
+        const char delimiter
+    )
+    {
+        if constexpr (I != 0) {
+            if (result.ptr == last || *result.ptr != delimiter) {
+                result.ec = std::errc::invalid_argument;
+                return false;
+            }
+            ++result.ptr;
+        }
+        result = detail::from_chars_fixed_base<field_at<I>::base>(
+            result.ptr, last, std::get<I>(values)
+        );
+        return result.ec == std::errc {};
+    }
+
+    template <std::size_t I>
+    static constexpr bool format_field(
+        std::to_chars_result& result, //
+        char* const last,
+        const value_type& values,
+        const char delimiter
+    )
+    {
+        if constexpr (I != 0) {
+            if (result.ptr == last) {
+                result.ec = std::errc::value_too_large;
+                return false;
+            }
+            *result.ptr++ = delimiter;
+        }
+        result = detail::to_chars_fixed_base<field_at<I>::base>(
+            result.ptr, last, std::get<I>(values)
+        );
+        return result.ec == std::errc {};
+    }
+};
+
+namespace detail {
+
+inline constexpr auto u128_pow10_table = []() consteval {
+    std::array<uint128_t, 39> result {};
+    result[0] = 1;
+    for (std::size_t i = 1; i < result.size(); ++i) {
+        result[i] = result[i - 1] * 10;
+    }
+    return result;
+}();
+
+/// @brief The maximum length of a decimal with a scale in `[0, 38]` stored in an `int128_t`,
+/// which is reached by a sign, 39 digits, and a decimal point.
+inline constexpr std::ptrdiff_t max_decimal128_chars = 41;
+
+/// @brief Writes exactly `length` decimal digits of `x`, where `length <= 38`,
+/// with leading zeros if `x` has fewer digits than that.
+constexpr void write_u128_decimal_digits(char* const out, const uint128_t x, const int length)
+{
+    CHARCONV_EXT_ASSERT(length >= 0);
+    CHARCONV_EXT_ASSERT(length <= 38);
+
+    constexpr int chunk_length = 19;
+    if (length <= chunk_length) {
+        write_u64_digits(out, std::uint64_t(x), length, 10);
+        return;
+    }
+    const int head_length = length - chunk_length;
+    const auto [quotient, remainder] = u64_max_power_dividers[10].divmod(x);
+    write_u64_digits(out, std::uint64_t(quotient), head_length, 10);
+    write_u64_digits(out + head_length, remainder, chunk_length, 10);
+}
+
+/// @brief Writes `value / pow(10, scale)` in decimal to `out`,
+/// where at least `max_decimal128_chars` characters must be available.
+/// The decimal point is placed while the digits are written,
+/// by writing the integer part and exactly `scale` fractional digits separately.
+/// Returns the end of the output.
+constexpr char* write_decimal128(char* out, const int128_t value, const int scale)
+{
+    *out = '-';
+    out += value < 0;
+    const uint128_t magnitude = value < 0 ? -uint128_t(value) : uint128_t(value);
+    if (scale == 0) {
+        return to_chars_any(out, out + 39, magnitude, 10).ptr;
+    }
+
+    uint128_t integer;
+    uint128_t fraction;
+    if (magnitude <= std::uint64_t(-1) && scale <= 19) {
+        // Most decimals are small, and 64-bit division is much cheaper.
+        const std::uint64_t power = u64_pow10_table[std::size_t(scale)];
+        integer = std::uint64_t(magnitude) / power;
+        fraction = std::uint64_t(magnitude) % power;
+    }
+    else {
+        const divider<uint128_t>& power = u128_pow10_dividers[std::size_t(scale)];
+        const auto [quotient, remainder] = power.divmod(magnitude);
+        integer = quotient;
+        fraction = remainder;
+    }
+    out = to_chars_any(out, out + 39, integer, 10).ptr;
+    *out++ = '.';
+    write_u128_decimal_digits(out, fraction, scale);
+    return out + scale;
+}
+
+/// @brief Parses all of `[first, last)` as a decimal with at most `precision` digits,
+/// of which `scale` are fractional, into the unscaled `int128_t` value.
+constexpr std::errc parse_decimal128(
+    const char* const first, //
+    const char* const last,
+    int128_t& out,
+    const int precision,
+    const int scale
+)
+{
+    const bool negative = first != last && *first == '-';
+    const char* const integer_first = first + negative;
+
+    uint128_t integer {};
+    const std::from_chars_result integer_result
+        = from_chars_any(integer_first, last, integer, 10);
+    if (integer_result.ec == std::errc::invalid_argument) {
+        return integer_result.ec;
+    }
+
+    const char* fraction_first = integer_result.ptr;
+    const char* fraction_last = fraction_first;
+    if (fraction_first != last && *fraction_first == '.') {
+        ++fraction_first;
+        fraction_last = fraction_first + pattern_length(fraction_first, last, 10);
+        if (fraction_last == fraction_first) {
+            return std::errc::invalid_argument;
+        }
+    }
+    if (fraction_last != last) {
+        return std::errc::invalid_argument;
+    }
+
+    // Fractional digits beyond the scale are only allowed if they are zero,
+    // since anything else would lose data.
+    const auto fraction_length
+        = int(std::min(fraction_last - fraction_first, std::ptrdiff_t(scale)));
+    const char* const significant_last = fraction_first + fraction_length;
+    if (std::any_of(significant_last, fraction_last, [](char c) { return c != '0'; })) {
+        return std::errc::result_out_of_range;
+    }
+    if (integer_result.ec != std::errc {}
+        || integer >= u128_pow10_table[std::size_t(precision - scale)]) {
+        return std::errc::result_out_of_range;
+    }
+
+    uint128_t fraction = 0;
+    if (fraction_length > 19) {
+        fraction = uint128_t(parse_u64_digits(fraction_first, fraction_length - 19, 10))
+            * u64_pow10_table[19];
+    }
+    fraction += parse_u64_digits(
+        fraction_first + std::max(fraction_length - 19, 0), std::min(fraction_length, 19), 10
+    );
+
+    const uint128_t magnitude = integer * u128_pow10_table[std::size_t(scale)]
+        + fraction * u128_pow10_table[std::size_t(scale - fraction_length)];
+    out = int128_t(negative ? -magnitude : magnitude);
+    return std::errc {};
+}
+
+} // namespace detail
+
+/// @brief The result of a column conversion.
+/// `count` is the number of values that were converted before an error occurred,
+/// or the number of all values on success.
+struct column_result {
+    std::size_t count;
+    std::errc ec;
+};
+
+/// @brief Formats a column of Arrow-style `Decimal128` values with the given `scale`
+/// into a string column, consisting of the character data in `[first, last)`
+/// and `values.size() + 1` `offsets`, such that value `i` is in
+/// `[first + offsets[i], first + offsets[i + 1])`.
+///
+/// `validity` is a bitmap where bit `i % 8` of byte `i / 8` is set if value `i` is not null,
+/// or empty if there are no nulls.
+/// Null values are written as empty strings.
+/// To avoid branches, every value is formatted, and the output position only advances
+/// over non-null values.
+///
+/// If `[first, last)` is too small, returns `std::errc::value_too_large`.
+constexpr column_result to_chars_decimal_column(
+    char* const first, //
+    char* last,
+    const std::span<const int128_t> values,
+    const std::span<const std::byte> validity,
+    const std::span<std::int32_t> offsets,
+    const int scale
+)
+{
+    CHARCONV_EXT_ASSERT(first);
+    CHARCONV_EXT_ASSERT(last);
+    CHARCONV_EXT_ASSERT(scale >= 0);
+    CHARCONV_EXT_ASSERT(scale <= 38);
+    CHARCONV_EXT_ASSERT(offsets.size() == values.size() + 1);
+    CHARCONV_EXT_ASSERT(validity.empty() || validity.size() >= (values.size() + 7) / 8);
+
+    // Offsets are 32-bit, so the output cannot be longer than that.
+    last = first + std::min(last - first, std::ptrdiff_t(INT32_MAX));
+
+    char* current = first;
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        offsets[i] = std::int32_t(current - first);
+        const bool valid
+            = validity.empty() || ((std::to_integer<unsigned>(validity[i / 8]) >> (i % 8)) & 1);
+
+        if (last - current >= detail::max_decimal128_chars) {
+            char* const cell_last = detail::write_decimal128(current, values[i], scale);
+            current = valid ? cell_last : current;
+        }
+        else {
+            char buffer[detail::max_decimal128_chars];
+            const char* const buffer_last = detail::write_decimal128(buffer, values[i], scale);
+            const std::ptrdiff_t length = valid ? buffer_last - buffer : 0;
+            if (last - current < length) {
+                return { i, std::errc::value_too_large };
+            }
+            current = std::ranges::copy(buffer, buffer + length, current).out;
+        }
+    }
+    offsets[values.size()] = std::int32_t(current - first);
+    return { values.size(), std::errc {} };
+}
+
+/// @brief Parses a string column, with the layout described for `to_chars_decimal_column`,
+/// into Arrow-style `Decimal128` values with the given `precision` and `scale`.
+///
+/// Empty strings are null, and are stored as zero.
+/// Every other string must consist of an optional `'-'`, one or more digits,
+/// and optionally a `'.'` followed by one or more digits.
+/// All bytes of `validity` which cover the values are written.
+/// On error, only the bytes which cover the values up to and including the failing one
+/// are written, with a set bit for the failing value, and no bits for the values after it.
+///
+/// If a string does not match this pattern, returns `std::errc::invalid_argument`.
+/// If it has more than `precision - scale` integer digits, not counting leading zeros,
+/// or nonzero fractional digits beyond `scale`, returns `std::errc::result_out_of_range`.
+constexpr column_result from_chars_decimal_column(
+    const char* const data, //
+    const std::span<const std::int32_t> offsets,
+    const std::span<int128_t> values,
+    const std::span<std::byte> validity,
+    const int precision,
+    const int scale
+)
+{
+    CHARCONV_EXT_ASSERT(data);
+    CHARCONV_EXT_ASSERT(precision >= 1);
+    CHARCONV_EXT_ASSERT(precision <= 38);
+    CHARCONV_EXT_ASSERT(scale >= 0);
+    CHARCONV_EXT_ASSERT(scale <= precision);
+    CHARCONV_EXT_ASSERT(offsets.size() == values.size() + 1);
+    CHARCONV_EXT_ASSERT(validity.size() >= (values.size() + 7) / 8);
+
+    unsigned validity_byte = 0;
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        const char* const first = data + offsets[i];
+        const char* const last = data + offsets[i + 1];
+        const bool valid = first != last;
+        validity_byte |= unsigned(valid) << (i % 8);
+        if (i % 8 == 7) {
+            validity[i / 8] = std::byte(validity_byte);
+            validity_byte = 0;
+        }
+
+        values[i] = 0;
+        if (valid) {
+            const std::errc ec = detail::parse_decimal128(first, last, values[i], precision, scale);
+            if (ec != std::errc {}) {
+                validity[i / 8] = std::byte(validity_byte);
+                return { i, ec };
+            }
+        }
+    }
+    if (values.size() % 8 != 0) {
+        validity[values.size() / 8] = std::byte(validity_byte);
+    }
+    return { values.size(), std::errc {} };
+}
+
+namespace detail {
+
+/// @brief Returns `1` for a positive and `-1` for a negative sign nibble
+/// of a packed or zoned decimal number, and `0` if `nibble` is not a sign.
+/// `0xc` and `0xd` are the preferred signs, and `0xf` is used by unsigned fields.
+[[nodiscard]]
+constexpr int decimal_sign(const unsigned nibble)
+{
+    switch (nibble) {
+    case 0xa:
+    case 0xc:
+    case 0xe:
+    case 0xf: return 1;
+    case 0xb:
+    case 0xd: return -1;
+    default: return 0;
+    }
+}
+
+/// @brief Returns `true` if any nibble of `x` is greater than 9,
+/// which is the case if its highest bit and one of its two middle bits are set.
+[[nodiscard]]
+constexpr bool has_non_decimal_nibble(const std::uint64_t x)
+{
+    return ((x >> 3) & ((x >> 1) | (x >> 2)) & 0x1111111111111111) != 0;
+}
+
+/// @brief Returns the value of the sixteen packed BCD digits in `x`,
+/// with the most significant digit in the most significant nibble.
+/// Neighboring digits, pairs, quadruples, and octuples are combined in four steps,
+/// each of which subtracts the difference between `pow(2, 4 * n)` and `pow(10, n)`
+/// for every unit of the higher half.
+[[nodiscard]]
+constexpr std::uint64_t combine_16_bcd_digits(std::uint64_t x)
+{
+    x -= ((x >> 4) & 0x0F0F0F0F0F0F0F0F) * (16 - 10);
+    x -= ((x >> 8) & 0x00FF00FF00FF00FF) * (256 - 100);
+    x -= ((x >> 16) & 0x0000FFFF0000FFFF) * (65536 - 10000);
+    x -= (x >> 32) * ((std::uint64_t { 1 } << 32) - 100'000'000);
+    return x;
+}
+
+/// @brief Returns the packed BCD bytes for eight decimal digit characters,
+/// with the first pair of digits in the least significant byte.
+[[nodiscard]]
+constexpr std::uint32_t pack_8_digit_chars(const char* const p)
+{
+    std::uint64_t x = load_u64_le(p) - 0x3030303030303030;
+    x = ((x << 4) | (x >> 8)) & 0x00FF00FF00FF00FF;
+    x = (x | (x >> 8)) & 0x0000FFFF0000FFFF;
+    return std::uint32_t(x | (x >> 16));
+}
+
+/// @brief Parses exactly `length` digits of a zoned decimal number, where `length <= 19`,
+/// and clears `valid` unless each of them is a byte from `0xf0` to `0xf9`.
+[[nodiscard]]
+constexpr std::uint64_t parse_zoned_digits(const std::byte* p, int length, bool& valid)
+{
+    CHARCONV_EXT_ASSERT(length >= 0);
+    CHARCONV_EXT_ASSERT(length <= 19);
+
+    std::uint64_t result = 0;
+    for (; length >= 8; length -= 8, p += 8) {
+        const std::uint64_t x = load_u64_le(p);
+        const std::uint64_t digits = x & 0x0F0F0F0F0F0F0F0F;
+        // Adding 6 to a digit nibble carries into the zone nibble if the digit is above 9.
+        valid &= (x & 0xF0F0F0F0F0F0F0F0) == 0xF0F0F0F0F0F0F0F0;
+        valid &= ((digits + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0) == 0;
+        result = result * 100'000'000 + combine_8_decimal_digits(digits);
+    }
+    for (; length != 0; --length, ++p) {
+        const auto x = unsigned(*p);
+        valid &= (x >> 4) == 0xf && (x & 0xf) <= 9;
+        result = result * 10 + (x & 0xf);
+    }
+    return result;
+}
+
+/// @brief Writes the decimal digits of `magnitude`, where `magnitude <= pow(2, 127)`,
+/// as exactly `length` characters, where `length <= 39`.
+constexpr void write_magnitude_digits(char* const out, uint128_t magnitude, const int length)
+{
+    CHARCONV_EXT_ASSERT(length <= 39);
+
+    if (length == 39) {
+        const bool high = magnitude >= u128_pow10_table[38];
+        out[0] = char('0' + high);
+        magnitude -= high ? u128_pow10_table[38] : 0;
+        write_u128_decimal_digits(out + 1, magnitude, 38);
+        return;
+    }
+    write_u128_decimal_digits(out, magnitude, length);
+}
+
+/// @brief Returns `value` as a signed integer for the sign `sign`,
+/// or `std::errc::result_out_of_range` if its magnitude is too large.
+constexpr std::errc
+store_signed_magnitude(int128_t& value, const uint128_t magnitude, const int sign)
+{
+    const uint128_t limit = (uint128_t { 1 } << 127) - (sign > 0);
+    if (magnitude > limit) {
+        return std::errc::result_out_of_range;
+    }
+    value = int128_t(sign < 0 ? -magnitude : magnitude);
+    return std::errc {};
+}
+
+} // namespace detail
+
+/// @brief Parses a packed decimal (BCD, COBOL `COMP-3`) number,
+/// which consists of two digits per byte, most significant first,
+/// except for the last byte, whose low nibble is the sign.
+/// Returns `std::errc::invalid_argument` if a digit or the sign is invalid,
+/// and `std::errc::result_out_of_range` if the value does not fit into `int128_t`.
+/// `value` is only modified on success.
+constexpr std::errc from_packed_bcd(const std::span<const std::byte> bytes, int128_t& value)
+{
+    if (bytes.empty()) {
+        return std::errc::invalid_argument;
+    }
+    const int sign = detail::decimal_sign(unsigned(bytes.back()) & 0xf);
+
+    // The last sixteen bytes hold up to 31 digits and the sign,
+    // so after dropping the sign nibble, they are two words of sixteen and fifteen digits.
+    const std::size_t tail_size = std::min(bytes.size(), std::size_t { 16 });
+    uint128_t tail = 0;
+    for (const std::byte b : bytes.last(tail_size)) {
+        tail = (tail << 8) | unsigned(b);
+    }
+    tail >>= 4;
+    const auto low = std::uint64_t(tail);
+    const auto high = std::uint64_t(tail >> 64);
+    bool valid = sign != 0 && !detail::has_non_decimal_nibble(low)
+        && !detail::has_non_decimal_nibble(high);
+    uint128_t magnitude = uint128_t(detail::combine_16_bcd_digits(high)) * 10'000'000'000'000'000
+        + detail::combine_16_bcd_digits(low);
+
+    // Any preceding bytes hold two more significant digits each.
+    uint128_t head = 0;
+    bool overflow = false;
+    for (const std::byte b : bytes.first(bytes.size() - tail_size)) {
+        const auto x = unsigned(b);
+        valid &= !detail::has_non_decimal_nibble(x);
+        overflow |= detail::mul_overflow(head, head, 100);
+        overflow |= detail::add_overflow(head, head, (x >> 4) * 10 + (x & 0xf));
+    }
+    if (!valid) {
+        return std::errc::invalid_argument;
+    }
+    if (head != 0) {
+        overflow |= detail::mul_overflow(head, head, detail::u128_pow10_table[31]);
+        overflow |= detail::add_overflow(magnitude, magnitude, head);
+    }
+    return overflow ? std::errc::result_out_of_range
+                    : detail::store_signed_magnitude(value, magnitude, sign);
+}
+
+/// @brief Writes `value` as a packed decimal (BCD, COBOL `COMP-3`) number
+/// which fills `bytes` exactly, with `2 * bytes.size() - 1` digits including leading zeros,
+/// and the sign nibble `0xc` for non-negative and `0xd` for negative values.
+/// Returns `std::errc::value_too_large` if the value has more digits.
+constexpr std::errc to_packed_bcd(const std::span<std::byte> bytes, const int128_t value)
+{
+    CHARCONV_EXT_ASSERT(!bytes.empty());
+
+    const bool negative = value < 0;
+    const uint128_t magnitude = negative ? -uint128_t(value) : uint128_t(value);
+    const std::size_t digits = 2 * bytes.size() - 1;
+    if (digits < 39 && magnitude >= detail::u128_pow10_table[digits]) {
+        return std::errc::value_too_large;
+    }
+
+    // The digits and the sign are written as characters first, and then packed in pairs.
+    // The sign nibbles 0xc and 0xd are written as the characters '0' + 0xc and '0' + 0xd,
+    // so that they are packed in the same way as the digits.
+    char chars[40] {};
+    const std::size_t char_count = std::min(2 * bytes.size(), std::size(chars));
+    detail::write_magnitude_digits(chars, magnitude, int(char_count - 1));
+    chars[char_count - 1] = char('0' + (negative ? 0xd : 0xc));
+
+    const std::size_t zero_bytes = bytes.size() - char_count / 2;
+    std::ranges::fill(bytes.first(zero_bytes), std::byte {});
+    std::byte* out = bytes.data() + zero_bytes;
+    std::size_t i = 0;
+    for (; char_count - i >= 8; i += 8, out += 4) {
+        const std::uint32_t packed = detail::pack_8_digit_chars(chars + i);
+        for (int j = 0; j < 4; ++j) {
+            out[j] = std::byte(packed >> (8 * j));
+        }
+    }
+    for (; i != char_count; i += 2) {
+        *out++ = std::byte(((chars[i] - '0') << 4) | (chars[i + 1] - '0'));
+    }
+    return std::errc {};
+}
+
+/// @brief Parses a zoned decimal number in EBCDIC, which consists of one digit per byte,
+/// from `0xf0` to `0xf9`, except that the high nibble of the last byte is the sign.
+/// Errors are reported like for `from_packed_bcd`.
+constexpr std::errc from_zoned_decimal(const std::span<const std::byte> bytes, int128_t& value)
+{
+    if (bytes.empty()) {
+        return std::errc::invalid_argument;
+    }
+    const auto last_byte = unsigned(bytes.back());
+    const int sign = detail::decimal_sign(last_byte >> 4);
+    bool valid = sign != 0 && (last_byte & 0xf) <= 9;
+
+    // All digits but the last are combined in chunks of 19, like in `from_chars`.
+    constexpr int chunk_length = 19;
+    const std::byte* current = bytes.data();
+    const std::byte* const digits_last = current + bytes.size() - 1;
+    const int head_length = int(bytes.size() - 1) % chunk_length;
+    uint128_t magnitude = detail::parse_zoned_digits(current, head_length, valid);
+    bool overflow = false;
+    for (current += head_length; current != digits_last; current += chunk_length) {
+        const std::uint64_t chunk = detail::parse_zoned_digits(current, chunk_length, valid);
+        overflow |= detail::mul_overflow(magnitude, magnitude, detail::u64_pow10_table[19]);
+        overflow |= detail::add_overflow(magnitude, magnitude, chunk);
+    }
+    overflow |= detail::mul_overflow(magnitude, magnitude, 10);
+    overflow |= detail::add_overflow(magnitude, magnitude, last_byte & 0xf);
+
+    if (!valid) {
+        return std::errc::invalid_argument;
+    }
+    return overflow ? std::errc::result_out_of_range
+                    : detail::store_signed_magnitude(value, magnitude, sign);
+}
+
+/// @brief Writes `value` as a zoned decimal number in EBCDIC which fills `bytes` exactly,
+/// with `bytes.size()` digits including leading zeros,
+/// and the sign `0xc` for non-negative and `0xd` for negative values in the last byte.
+/// Returns `std::errc::value_too_large` if the value has more digits.
+constexpr std::errc to_zoned_decimal(const std::span<std::byte> bytes, const int128_t value)
+{
+    CHARCONV_EXT_ASSERT(!bytes.empty());
+
+    const bool negative = value < 0;
+    const uint128_t magnitude = negative ? -uint128_t(value) : uint128_t(value);
+    if (bytes.size() < 39 && magnitude >= detail::u128_pow10_table[bytes.size()]) {
+        return std::errc::value_too_large;
+    }
+
+    char chars[39] {};
+    const std::size_t digits = std::min(bytes.size(), std::size(chars));
+    detail::write_magnitude_digits(chars, magnitude, int(digits));
+
+    const std::size_t zero_digits = bytes.size() - digits;
+    std::ranges::fill(bytes.first(zero_digits), std::byte { 0xf0 });
+    // The characters '0' to '9' are 0x30 to 0x39, so setting the two highest bits
+    // turns them into the EBCDIC digits 0xf0 to 0xf9.
+    for (std::size_t i = 0; i < digits; ++i) {
+        bytes[zero_digits + i] = std::byte(chars[i] | 0xc0);
+    }
+    bytes.back() = std::byte((unsigned(bytes.back()) & 0xf) | (negative ? 0xd0 : 0xc0));
+    return std::errc {};
+}
+
+namespace detail {
+
+#ifdef CHARCONV_EXT_SSE2
+/// @brief Returns the sixteen hexadecimal digits of `x`, most significant digit first.
+/// The bytes are reversed and split into their high and low nibbles, which are interleaved,
+/// and then every nibble above 9 is moved from the range after `'9'` to the range of `'a'`.
+[[nodiscard]]
+inline __m128i expand_16_nibbles_sse2(const std::uint64_t x)
+{
+    const __m128i bytes = _mm_set_epi64x(0, std::int64_t(__builtin_bswap64(x)));
+    const __m128i nibble_mask = _mm_set1_epi8(0x0f);
+    const __m128i high = _mm_and_si128(_mm_srli_epi16(bytes, 4), nibble_mask);
+    const __m128i low = _mm_and_si128(bytes, nibble_mask);
+    const __m128i nibbles = _mm_unpacklo_epi8(high, low);
+    const __m128i is_letter = _mm_cmpgt_epi8(nibbles, _mm_set1_epi8(9));
+    const __m128i letter_offset = _mm_and_si128(is_letter, _mm_set1_epi8('a' - '0' - 10));
+    return _mm_add_epi8(_mm_add_epi8(nibbles, _mm_set1_epi8('0')), letter_offset);
+}
+
+/// @brief Returns a mask with bit `i` set if `chars[i]` is a hexadecimal digit.
+[[nodiscard]]
+inline unsigned hex_digit_mask_sse2(const __m128i chars)
+{
+    const auto in_range = [](const __m128i x, const char low, const char high) {
+        return _mm_and_si128(
+            _mm_cmpgt_epi8(x, _mm_set1_epi8(char(low - 1))),
+            _mm_cmpgt_epi8(_mm_set1_epi8(char(high + 1)), x)
+        );
+    };
+    const __m128i lower = _mm_or_si128(chars, _mm_set1_epi8(0x20));
+    const __m128i is_digit = _mm_or_si128(in_range(chars, '0', '9'), in_range(lower, 'a', 'f'));
+    return unsigned(_mm_movemask_epi8(is_digit));
+}
+
+/// @brief Returns the value of the sixteen hexadecimal digits in `chars`, which must be valid.
+/// Every pair of digit values is combined into a byte within its 16-bit lane,
+/// and the bytes are packed and reversed, so that the first digit becomes the most significant.
+[[nodiscard]]
+inline std::uint64_t collect_16_nibbles_sse2(const __m128i chars)
+{
+    const __m128i lower = _mm_or_si128(chars, _mm_set1_epi8(0x20));
+    const __m128i is_letter = _mm_cmpgt_epi8(lower, _mm_set1_epi8('9'));
+    const __m128i letter_offset = _mm_and_si128(is_letter, _mm_set1_epi8('a' - '0' - 10));
+    const __m128i values = _mm_sub_epi8(_mm_sub_epi8(lower, _mm_set1_epi8('0')), letter_offset);
+    const __m128i first = _mm_and_si128(values, _mm_set1_epi16(0x00ff));
+    const __m128i pairs = _mm_or_si128(_mm_slli_epi16(first, 4), _mm_srli_epi16(values, 8));
+    std::uint64_t result;
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(&result), _mm_packus_epi16(pairs, pairs));
+    return __builtin_bswap64(result);
+}
+#endif
+
+/// @brief Returns the end of the digits in base 2 or 16 at the start of `[current, last)`.
+[[nodiscard]]
+inline const char*
+find_bitset_digits_last(const char* current, const char* const last, const int base)
+{
+#ifdef CHARCONV_EXT_SSE2
+    for (; last - current >= 16; current += 16) {
+        const __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(current));
+        const unsigned mask
+            = base == 2 ? binary_digit_mask_sse2(chars) : hex_digit_mask_sse2(chars);
+        if (mask != 0xffff) {
+            return current + std::countr_zero(~mask);
+        }
+    }
+#endif
+    return current + pattern_length(current, last, base);
+}
+
+/// @brief Parses exactly 64 binary or 16 hexadecimal digits, which must be valid.
+[[nodiscard]]
+inline std::uint64_t parse_bitset_word(const char* const p, const int base)
+{
+#ifdef CHARCONV_EXT_SSE2
+    if (base == 2) {
+        std::uint64_t result = 0;
+        for (int i = 0; i < 4; ++i) {
+            const __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 16 * i));
+            result = result << 16 | collect_16_bits_sse2(chars);
+        }
+        return result;
+    }
+    return collect_16_nibbles_sse2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)));
+#else
+    return parse_u64_digits(p, base == 2 ? 64 : 16, base);
+#endif
+}
+
+/// @brief Writes all 64 binary or 16 hexadecimal digits of `x` to `out`.
+inline void write_bitset_word(char* const out, const std::uint64_t x, const int base)
+{
+#ifdef CHARCONV_EXT_SSE2
+    if (base == 2) {
+        for (int i = 0; i < 4; ++i) {
+            const auto bits = std::uint32_t(x >> (48 - 16 * i) & 0xffff);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 16 * i), expand_16_bits_sse2(bits));
+        }
+    }
+    else {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out), expand_16_nibbles_sse2(x));
+    }
+#else
+    write_u64_digits(out, x, base == 2 ? 64 : 16, base);
+#endif
+}
+
+/// @brief `true` if `std::bitset<N>` is known to consist of nothing but its bits,
+/// stored in little-endian words with the unused high bits set to zero,
+/// so that it can be reinterpreted as an array of 64-bit words.
+template <std::size_t N>
+inline constexpr bool bitset_is_word_array =
+#if defined(__GLIBCXX__) || defined(_LIBCPP_VERSION) || defined(_MSVC_STL_VERSION)
+    std::endian::native == std::endian::little && std::is_trivially_copyable_v<std::bitset<N>>
+    && sizeof(std::bitset<N>) == (N + 63) / 64 * sizeof(std::uint64_t);
+#else
+    false;
+#endif
+
+template <std::size_t N>
+using bitset_words = std::array<std::uint64_t, (N + 63) / 64>;
+
+/// @brief Returns the bits of `value` as 64-bit words, least significant word first.
+template <std::size_t N>
+[[nodiscard]]
+bitset_words<N> to_bitset_words(const std::bitset<N>& value)
+{
+    if constexpr (bitset_is_word_array<N>) {
+        return std::bit_cast<bitset_words<N>>(value);
+    }
+    else {
+        bitset_words<N> words {};
+        for (std::size_t i = 0; i < N; ++i) {
+            words[i / 64] |= std::uint64_t(value[i]) << (i % 64);
+        }
+        return words;
+    }
+}
+
+/// @brief Returns the bitset with the given words, least significant word first.
+/// The bits of the last word beyond `N` have to be zero.
+template <std::size_t N>
+[[nodiscard]]
+std::bitset<N> from_bitset_words(const bitset_words<N>& words)
+{
+    if constexpr (bitset_is_word_array<N>) {
+        return std::bit_cast<std::bitset<N>>(words);
+    }
+    else {
+        std::bitset<N> result;
+        for (std::size_t i = 0; i < N; ++i) {
+            result[i] = (words[i / 64] >> (i % 64) & 1) != 0;
+        }
+        return result;
+    }
+}
+
+} // namespace detail
+
+/// @brief Writes all bits of `value` in base 2 or 16, most significant digit first,
+/// including leading zeros like `std::bitset::to_string`.
+/// The bitset is converted 64 bits at a time, without an intermediate string.
+template <std::size_t N>
+std::to_chars_result to_chars(
+    char* const first, //
+    char* const last,
+    const std::bitset<N>& value,
+    const int base = 2
+)
+{
+    CHARCONV_EXT_ASSERT(first);
+    CHARCONV_EXT_ASSERT(last);
+    CHARCONV_EXT_ASSERT(base == 2 || base == 16);
+
+    const auto length = std::ptrdiff_t(base == 2 ? N : (N + 3) / 4);
+    if (last - first < length) {
+        return { last, std::errc::value_too_large };
+    }
+
+    const std::ptrdiff_t word_digits = base == 2 ? 64 : 16;
+    const detail::bitset_words<N> words = detail::to_bitset_words(value);
+    char* current = first + length;
+    std::size_t i = 0;
+    for (; current - first >= word_digits; current -= word_digits, ++i) {
+        detail::write_bitset_word(current - word_digits, words[i], base);
+    }
+    if (current != first) {
+        detail::write_u64_digits(first, words[i], int(current - first), base);
+    }
+    return { first + length, std::errc {} };
+}
+
+/// @brief Parses digits in base 2 or 16 into a bitset, where the last digit holds the lowest bits.
+/// Leading zeros are allowed, and if any bit beyond the first `N` is set,
+/// the result is `std::errc::result_out_of_range`.
+template <std::size_t N>
+std::from_chars_result from_chars(
+    const char* const first, //
+    const char* const last,
+    std::bitset<N>& out,
+    const int base = 2
+)
+{
+    CHARCONV_EXT_ASSERT(first);
+    CHARCONV_EXT_ASSERT(last);
+    CHARCONV_EXT_ASSERT(base == 2 || base == 16);
+
+    const char* const digits_last = detail::find_bitset_digits_last(first, last, base);
+    if (digits_last == first) {
+        return { first, std::errc::invalid_argument };
+    }
+    const std::ptrdiff_t word_digits = base == 2 ? 64 : 16;
+
+    // The digits are consumed from the end, in words of 64 bits.
+    detail::bitset_words<N> words {};
+    bool overflow = false;
+    std::size_t i = 0;
+    for (const char* word_last = digits_last; word_last != first; ++i) {
+        const std::ptrdiff_t word_length = std::min(word_digits, word_last - first);
+        word_last -= word_length;
+        const std::uint64_t word = word_length == word_digits
+            ? detail::parse_bitset_word(word_last, base)
+            : detail::parse_u64_digits(word_last, int(word_length), base);
+        if (i < words.size()) {
+            words[i] = word;
+        }
+        else {
+            overflow |= word != 0;
+        }
+    }
+    if constexpr (N % 64 != 0) {
+        overflow |= (words.back() >> (N % 64)) != 0;
+    }
+
+    if (overflow) {
+        return { digits_last, std::errc::result_out_of_range };
+    }
+    out = detail::from_bitset_words<N>(words);
+    return { digits_last, std::errc {} };
+}
+
+#ifdef CHARCONV_EXT_IOSTREAM
+namespace detail {
+
+[[nodiscard]]
+inline int stream_base(const std::ios_base::fmtflags flags)
+{
+    switch (flags & std::ios_base::basefield) {
+    case std::ios_base::hex: return 16;
+    case std::ios_base::oct: return 8;
+    case std::ios_base::dec: return 10;
+    default: return 0;
+    }
+}
+
+/// @brief Returns `true` if signed integers are inserted as their two's complement,
+/// which `std::num_put` does in octal and hexadecimal.
+[[nodiscard]]
+inline bool inserts_twos_complement(const std::ios_base::fmtflags flags)
+{
+    const int base = stream_base(flags);
+    return base == 8 || base == 16;
+}
+
+inline void put_fill(std::streambuf& buffer, const char fill, std::streamsize count)
+{
+    for (; count > 0; --count) {
+        buffer.sputc(fill);
+    }
+}
+
+/// @brief Inserts an integer with the given sign and magnitude into `out`,
+/// honoring `std::ios_base::basefield`, `uppercase`, `showbase`, `showpos`,
+/// `adjustfield`, the width, and the fill character.
+/// Unlike `std::num_put`, this does not consult the locale (there is no digit grouping),
+/// and the characters are written to the stream buffer without any allocation.
+inline std::ostream& insert_integer(
+    std::ostream& out, //
+    const uint128_t magnitude,
+    const bool negative,
+    const bool is_signed
+)
+{
+    const std::ostream::sentry sentry(out);
+    if (!sentry) {
+        return out;
+    }
+    const std::ios_base::fmtflags flags = out.flags();
+    const int base = stream_base(flags) == 0 ? 10 : stream_base(flags);
+
+    // The prefix consists of at most three characters, like "-0x",
+    // and the digits of a 128-bit integer in base 8 take up at most 43 characters.
+    // The octal base "0" is a digit rather than a prefix, so internal padding goes before it.
+    char prefix[3];
+    std::size_t prefix_length = 0;
+    if (negative) {
+        prefix[prefix_length++] = '-';
+    }
+    else if (is_signed && base == 10 && (flags & std::ios_base::showpos)) {
+        prefix[prefix_length++] = '+';
+    }
+    char digits[64];
+    char* digits_first = digits;
+    if ((flags & std::ios_base::showbase) && magnitude != 0) {
+        if (base == 16) {
+            prefix[prefix_length++] = '0';
+            prefix[prefix_length++] = (flags & std::ios_base::uppercase) ? 'X' : 'x';
+        }
+        else if (base == 8) {
+            *digits_first++ = '0';
+        }
+    }
+
+    const std::to_chars_result result
+        = to_chars_any(digits_first, std::end(digits), magnitude, base);
+    CHARCONV_EXT_ASSERT(result.ec == std::errc {});
+    const auto digits_length = result.ptr - digits;
+    if (base == 16 && (flags & std::ios_base::uppercase)) {
+        for (char* p = digits; p != result.ptr; ++p) {
+            *p = *p >= 'a' ? char(*p - 'a' + 'A') : *p;
+        }
+    }
+
+    std::streambuf& buffer = *out.rdbuf();
+    const std::streamsize padding
+        = out.width() - std::streamsize(prefix_length) - std::streamsize(digits_length);
+    const std::ios_base::fmtflags adjust = flags & std::ios_base::adjustfield;
+    out.width(0);
+
+    if (adjust != std::ios_base::left && adjust != std::ios_base::internal) {
+        put_fill(buffer, out.fill(), padding);
+    }
+    bool ok = buffer.sputn(prefix, std::streamsize(prefix_length))
+        == std::streamsize(prefix_length);
+    if (adjust == std::ios_base::internal) {
+        put_fill(buffer, out.fill(), padding);
+    }
+    ok &= buffer.sputn(digits, digits_length) == digits_length;
+    if (adjust == std::ios_base::left) {
+        put_fill(buffer, out.fill(), padding);
+    }
+    if (!ok) {
+        out.setstate(std::ios_base::badbit);
+    }
+    return out;
+}
+
+/// @brief Extracts an integer from `in`, similar to `std::num_get`.
+/// If `std::ios_base::basefield` is not set, the base is detected from a `0x` or `0` prefix.
+/// For unsigned types, a minus sign negates the value with wrap-around.
+/// On failure, `failbit` is set and `out` is set to zero.
+/// If the value is out of range, `failbit` is set and `out` is set to `min` or `max`.
+template <typename T>
+std::istream& extract_integer(std::istream& in, T& out, const T min, const T max)
+{
+    using traits = std::istream::traits_type;
+
+    const std::istream::sentry sentry(in);
+    if (!sentry) {
+        return in;
+    }
+    std::streambuf& buffer = *in.rdbuf();
+    std::ios_base::iostate state = std::ios_base::goodbit;
+
+    // Leading zeros are not stored, so 130 characters are enough to hold a sign
+    // and any digit sequence which could possibly be in range.
+    char chars[130];
+    std::size_t length = 0;
+    bool truncated = false;
+    bool any_digits = false;
+
+    auto c = buffer.sgetc();
+    const auto advance = [&] {
+        c = buffer.snextc();
+        return !traits::eq_int_type(c, traits::eof());
+    };
+    bool more = !traits::eq_int_type(c, traits::eof());
+
+    if (more && (traits::to_char_type(c) == '-' || traits::to_char_type(c) == '+')) {
+        if (traits::to_char_type(c) == '-') {
+            chars[length++] = '-';
+        }
+        more = advance();
+    }
+
+    int base = stream_base(in.flags());
+    if (more && (base == 0 || base == 16) && traits::to_char_type(c) == '0') {
+        any_digits = true;
+        more = advance();
+        if (more && (traits::to_char_type(c) == 'x' || traits::to_char_type(c) == 'X')) {
+            // Like std::num_get, "0x" is only a prefix, and has to be followed by a digit.
+            any_digits = false;
+            base = 16;
+            more = advance();
+        }
+        else if (base == 0) {
+            base = 8;
+        }
+    }
+    base = base == 0 ? 10 : base;
+
+    for (; more; more = advance()) {
+        const int value = digit_value(traits::to_char_type(c));
+        if (value < 0 || value >= base) {
+            break;
+        }
+        any_digits = true;
+        if (value == 0 && (length == 0 || (length == 1 && chars[0] == '-'))) {
+            continue;
+        }
+        if (length == std::size(chars)) {
+            truncated = true;
+        }
+        else {
+            chars[length++] = traits::to_char_type(c);
+        }
+    }
+    if (!more) {
+        state |= std::ios_base::eofbit;
+    }
+
+    if (!any_digits) {
+        out = 0;
+        state |= std::ios_base::failbit;
+    }
+    else if (length == 0 || (length == 1 && chars[0] == '-')) {
+        out = 0;
+    }
+    else {
+        const bool negate = chars[0] == '-' && !is_signed_integer<T>;
+        const std::from_chars_result result
+            = from_chars_any(chars + negate, chars + length, out, base);
+        if (truncated || result.ec == std::errc::result_out_of_range) {
+            out = chars[0] == '-' && !negate ? min : max;
+            state |= std::ios_base::failbit;
+        }
+        else if (result.ec != std::errc {}) {
+            out = 0;
+            state |= std::ios_base::failbit;
+        }
+        else if (negate) {
+            out = T(-out);
+        }
+    }
+    in.setstate(state);
+    return in;
+}
+
+} // namespace detail
+
+inline std::ostream& operator<<(std::ostream& out, const uint128_t x)
+{
+    return detail::insert_integer(out, x, false, false);
+}
+
+inline std::ostream& operator<<(std::ostream& out, const int128_t x)
+{
+    if (detail::inserts_twos_complement(out.flags())) {
+        return detail::insert_integer(out, uint128_t(x), false, true);
+    }
+    return detail::insert_integer(out, x < 0 ? -uint128_t(x) : uint128_t(x), x < 0, true);
+}
+
+inline std::istream& operator>>(std::istream& in, uint128_t& x)
+{
+    return detail::extract_integer(in, x, uint128_t(0), uint128_t(-1));
+}
+
+inline std::istream& operator>>(std::istream& in, int128_t& x)
+{
+    const auto max = int128_t(uint128_t(-1) >> 1);
+    return detail::extract_integer(in, x, int128_t(-max - 1), max);
+}
+
+#ifdef CHARCONV_EXT_BITINT_MAXWIDTH
+template <std::size_t N>
+std::ostream& operator<<(std::ostream& out, const bit_int<N> x)
+{
+    static_assert(N <= 128, "Sorry, operator<< for _BitInt(129) and wider not implemented :(");
+    if (detail::inserts_twos_complement(out.flags())) {
+        return out << uint128_t(bit_uint<N>(x));
+    }
+    return out << int128_t(x);
+}
+
+template <std::size_t N>
+std::ostream& operator<<(std::ostream& out, const bit_uint<N> x)
+{
+    static_assert(N <= 128, "Sorry, operator<< for _BitInt(129) and wider not implemented :(");
+    return out << uint128_t(x);
+}
+
+template <std::size_t N>
+std::istream& operator>>(std::istream& in, bit_int<N>& x)
+{
+    static_assert(N <= 128, "Sorry, operator>> for _BitInt(129) and wider not implemented :(");
+    const auto max = bit_int<N>(bit_uint<N>(-1) >> 1);
+    return detail::extract_integer(in, x, bit_int<N>(-max - 1), max);
+}
+
+template <std::size_t N>
+std::istream& operator>>(std::istream& in, bit_uint<N>& x)
+{
+    static_assert(N <= 128, "Sorry, operator>> for _BitInt(129) and wider not implemented :(");
+    return detail::extract_integer(in, x, bit_uint<N>(0), bit_uint<N>(-1));
+}
+#endif
+#endif
+
+#ifdef CHARCONV_EXT_FD_WRITER
+namespace detail {
+
+/// @brief Writes all of `[iov, iov + count)` to the file descriptor,
+/// continuing after partial writes and interruptions by signals.
+inline std::errc write_all(const int fd, ::iovec* iov, int count)
+{
+    while (true) {
+        for (; count != 0 && iov->iov_len == 0; ++iov, --count) { }
+        if (count == 0) {
+            return std::errc {};
+        }
+        const ::ssize_t written = ::writev(fd, iov, count);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return std::errc(errno);
+        }
+        if (written == 0) {
+            return std::errc::io_error;
+        }
+        for (auto rest = std::size_t(written); rest != 0; ++iov, --count) {
+            if (rest < iov->iov_len) {
+                iov->iov_base = static_cast<char*>(iov->iov_base) + rest;
+                iov->iov_len -= rest;
+                break;
+            }
+            rest -= iov->iov_len;
+        }
+    }
+}
+
+} // namespace detail
+
+/// @brief Formats integers, including 128-bit and bit-precise integers, straight into
+/// a page-aligned buffer, which is written to a file descriptor whenever it is full.
+/// A number is never split between two writes, because it is only formatted if
+/// `max_chars` characters are left in the buffer.
+///
+/// Once writing fails, the error is sticky, and every function returns it
+/// without writing anything.
+/// The file descriptor is not owned, and the buffer is flushed (ignoring errors)
+/// on destruction.
+class fd_writer {
+public:
+    static constexpr std::size_t default_capacity = std::size_t(1) << 20;
+
+    /// @brief Allocates a buffer of at least `capacity` bytes,
+    /// rounded up to a multiple of the page size.
+    explicit fd_writer(const int fd, const std::size_t capacity = default_capacity)
+        : m_fd(fd)
+        , m_page_size(page_size())
+        , m_capacity(std::max(capacity + m_page_size - 1, m_page_size) / m_page_size * m_page_size)
+        , m_buffer(static_cast<char*>(::operator new(m_capacity, std::align_val_t(m_page_size))))
+    {
+    }
+
+    fd_writer(const fd_writer&) = delete;
+    fd_writer& operator=(const fd_writer&) = delete;
+
+    ~fd_writer()
+    {
+        static_cast<void>(flush());
+        ::operator delete(m_buffer, std::align_val_t(m_page_size));
+    }
+
+    /// @brief Formats `value` like `to_chars` into the buffer, followed by `separator`.
+    /// Like for `std::to_chars`, `bool` is not an integer type here.
+    template <typename T>
+        requires((std::is_integral_v<T> && !std::is_same_v<T, bool>)
+                 || detail::is_extended_integer<T>::value)
+    std::errc write(const T value, const std::string_view separator = {}, const int base = 10)
+    {
+        if (m_capacity - m_size < std::size_t(max_chars<T>(base))) {
+            if (const std::errc ec = flush(); ec != std::errc {}) {
+                return ec;
+            }
+        }
+        if (m_error != std::errc {}) {
+            return m_error;
+        }
+        char* const first = m_buffer + m_size;
+        const auto [p, ec] = detail::to_chars_any(first, m_buffer + m_capacity, value, base);
+        CHARCONV_EXT_ASSERT(ec == std::errc {});
+        m_size += std::size_t(p - first);
+        return separator.empty() ? std::errc {} : write(separator);
+    }
+
+    /// @brief Copies `text` into the buffer.
+    /// If it doesn't fit, the buffer and `text` are written with a single `writev`
+    /// instead, without copying `text`.
+    std::errc write(const std::string_view text)
+    {
+        if (m_error != std::errc {}) {
+            return m_error;
+        }
+        if (text.size() <= m_capacity - m_size) {
+            std::copy(text.begin(), text.end(), m_buffer + m_size);
+            m_size += text.size();
+            return std::errc {};
+        }
+        ::iovec iov[2] { { m_buffer, m_size }, { const_cast<char*>(text.data()), text.size() } };
+        m_size = 0;
+        m_error = detail::write_all(m_fd, iov, 2);
+        return m_error;
+    }
+
+    /// @brief Writes the contents of the buffer to the file descriptor.
+    std::errc flush()
+    {
+        if (m_error != std::errc {}) {
+            return m_error;
+        }
+        ::iovec iov { m_buffer, m_size };
+        m_size = 0;
+        m_error = detail::write_all(m_fd, &iov, 1);
+        return m_error;
+    }
+
+    /// @brief Returns the error of the first write which failed, or `std::errc {}`.
+    [[nodiscard]]
+    std::errc error() const noexcept
+    {
+        return m_error;
+    }
+
+    [[nodiscard]]
+    int fd() const noexcept
+    {
+        return m_fd;
+    }
+
+    [[nodiscard]]
+    std::size_t capacity() const noexcept
+    {
+        return m_capacity;
+    }
+
+    /// @brief Returns the number of bytes in the buffer, which have not been written yet.
+    [[nodiscard]]
+    std::size_t size() const noexcept
+    {
+        return m_size;
+    }
+
+private:
+    int m_fd;
+    std::size_t m_page_size;
+    std::size_t m_capacity;
+    char* m_buffer;
+    std::size_t m_size = 0;
+    std::errc m_error {};
+
+    [[nodiscard]]
+    static std::size_t page_size() noexcept
+    {
+        const long result = ::sysconf(_SC_PAGESIZE);
+        return result > 0 ? std::size_t(result) : 4096;
+    }
+};
 #endif
 
 } // namespace charconv_ext
@@ -1,7 +1,21 @@
+#include <bit>
+#include <bitset>
+#include <charconv>
+#include <cmath>
+#include <cstdio>
+#include <iomanip>
+#include <limits>
 #include <random>
+#include <sstream>
+#include <string>
 #include <string_view>
 #include <system_error>
+#include <tuple>
+#include <vector>
 
+#define CHARCONV_EXT_FD_WRITER
+#define CHARCONV_EXT_IOSTREAM
+#define CHARCONV_EXT_USDT
 #include "charconv_ext/charconv_ext.hpp"
 
 namespace charconv_ext {
@@ -24,6 +38,29 @@ static_assert(detail::u64_max_power(2) == 0);
 static_assert(detail::u64_max_power(8) == 0x8000000000000000ull);
 static_assert(detail::u64_max_power(10) == 10000000000000000000ull);
 static_assert(detail::u64_max_power(16) == 0);
+
+static_assert(detail::u64_digit_count(0, 10) == 1);
+static_assert(detail::u64_digit_count(9, 10) == 1);
+static_assert(detail::u64_digit_count(10, 10) == 2);
+static_assert(detail::u64_digit_count(9999999999999999999ull, 10) == 19);
+static_assert(detail::u64_digit_count(10000000000000000000ull, 10) == 20);
+static_assert(detail::u64_digit_count(0xff, 16) == 2);
+static_assert(detail::u64_digit_count(0x100, 16) == 3);
+static_assert(detail::u64_digit_count(uint64_t(-1), 2) == 64);
+static_assert(detail::u64_digit_count(uint64_t(-1), 3) == 41);
+static_assert(detail::u64_digit_count(26, 3) == 3);
+static_assert(detail::u64_digit_count(27, 3) == 4);
+
+#ifdef CHARCONV_EXT_X86_DISPATCH
+static_assert(detail::div_pow10_16(uint128_t(-1)) == uint128_t(-1) / 10000000000000000ull);
+static_assert(detail::div_pow10_16(10000000000000000ull) == 1);
+static_assert(detail::div_pow10_16(9999999999999999ull) == 0);
+#endif
+
+static_assert(detail::parse_8_decimal_digits("01234567") == 1234567);
+static_assert(detail::parse_8_decimal_digits("99999999") == 99999999);
+static_assert(detail::parse_u64_digits("18446744073709551615", 20, 10) == uint64_t(-1));
+static_assert(detail::parse_u64_digits("ffffffffffffffff", 16, 16) == uint64_t(-1));
 #endif
 
 template <typename T>
@@ -134,6 +171,257 @@ void run_manual_tests()
     }
 }
 
+template <typename T>
+struct from_chars_test_case {
+    std::string_view str;
+    int base;
+    std::errc ec;
+    T value;
+};
+
+// clang-format off
+static constexpr from_chars_test_case<uint128_t> from_chars_edge_cases_u128[] {
+    { "340282366920938463463374607431768211456", 10, std::errc::result_out_of_range, 0 },
+    { "1000000000000000000000000000000000000000000000000000000000", 10, std::errc::result_out_of_range, 0 },
+    { "0000000000000000000000000000000000000000000000000000000001", 10, std::errc {}, 1 },
+    { "100000000000000000000000000000000", 16, std::errc::result_out_of_range, 0 },
+    { "00000000000000000000000000000000000000000000000000000000000ff", 16, std::errc {}, 255 },
+    { "-1", 10, std::errc::invalid_argument, 0 },
+    { "", 10, std::errc::invalid_argument, 0 },
+};
+
+static constexpr from_chars_test_case<int128_t> from_chars_edge_cases_i128[] {
+    { "170141183460469231731687303715884105727", 10, std::errc {}, int128_t(u128_max >> 1) },
+    { "170141183460469231731687303715884105728", 10, std::errc::result_out_of_range, 0 },
+    { "-170141183460469231731687303715884105729", 10, std::errc::result_out_of_range, 0 },
+    { "-9223372036854775808", 10, std::errc {}, -int128_t(uint64_t(1) << 63) },
+    { "-9223372036854775809", 10, std::errc {}, -int128_t(uint64_t(1) << 63) - 1 },
+    { "-0000000000000000000000000000000000000000000000000000000042", 10, std::errc {}, -42 },
+    { "-80000000000000000000000000000001", 16, std::errc::result_out_of_range, 0 },
+    { "-", 10, std::errc::invalid_argument, 0 },
+    { "--1", 10, std::errc::invalid_argument, 0 },
+};
+// clang-format on
+
+template <typename T, std::size_t N>
+void run_from_chars_edge_cases(const from_chars_test_case<T> (&cases)[N])
+{
+    for (const auto& test : cases) {
+        const char* const first = test.str.data();
+        const char* const last = first + test.str.size();
+
+        T value = 123;
+        const auto [p, ec] = from_chars(first, last, value, test.base);
+        assert(ec == test.ec);
+        if (ec == std::errc::invalid_argument) {
+            assert(p == first);
+            assert(value == 123);
+        }
+        else {
+            assert(p == last);
+            assert(value == (ec == std::errc {} ? test.value : 123));
+        }
+    }
+}
+
+void run_small_value_tests()
+{
+    char buffer[64];
+    for (int base = 2; base <= 36; ++base) {
+        for (uint64_t x = 0; x < 100'000; x = x * 3 + 1) {
+            const auto expected = std::to_chars(buffer, std::end(buffer), x, base);
+            const std::string_view expected_str { buffer, expected.ptr };
+
+            char actual[64];
+            const auto [p, ec] = to_chars(actual, std::end(actual), uint128_t(x), base);
+            assert(ec == std::errc {});
+            assert(std::string_view(actual, p) == expected_str);
+
+            const auto [p_neg, ec_neg] = to_chars(actual, std::end(actual), -int128_t(x), base);
+            assert(ec_neg == std::errc {});
+            assert(std::string_view(actual + (x != 0), p_neg) == expected_str);
+        }
+    }
+
+    // Insufficient space is reported for every length, including ones that cut off a chunk.
+    for (std::size_t size = 0; size < 39; ++size) {
+        const auto [p, ec] = to_chars(buffer, buffer + size, u128_max);
+        assert(ec == std::errc::value_too_large);
+        assert(p == buffer + size);
+    }
+}
+
+/// @brief Converts `x` to decimal digit by digit, as a reference for the optimized paths.
+std::string_view naive_decimal(uint128_t x, char (&buffer)[64])
+{
+    char* p = std::end(buffer);
+    do {
+        *--p = char('0' + int(x % 10));
+        x /= 10;
+    } while (x != 0);
+    return { p, std::end(buffer) };
+}
+
+void run_decimal_tests()
+{
+    std::vector<uint128_t> values;
+    uint128_t power = 1;
+    for (int i = 0; i <= 38; ++i, power *= 10) {
+        values.insert(values.end(), { power - 1, power, power + 1, power * 9 });
+    }
+    values.push_back(u128_max);
+    values.push_back(u128_max - 1);
+
+    std::default_random_engine rng { 54321 };
+    std::uniform_int_distribution<uint64_t> u64_distr;
+    for (int i = 0; i < 100'000; ++i) {
+        const auto x = (uint128_t(u64_distr(rng)) << 64) | u64_distr(rng);
+        values.push_back(x >> (i % 64));
+    }
+
+    for (const uint128_t x : values) {
+        char expected_buffer[64];
+        const std::string_view expected = naive_decimal(x, expected_buffer);
+
+        char buffer[64];
+        const auto [p, ec] = to_chars(buffer, std::end(buffer), x);
+        assert(ec == std::errc {});
+        assert(std::string_view(buffer, p) == expected);
+
+        // The output must fit exactly, and nothing may be written past it.
+        std::ranges::fill(buffer, 'x');
+        const auto exact = to_chars(buffer, buffer + expected.size(), x);
+        assert(exact.ec == std::errc {});
+        assert(exact.ptr == buffer + expected.size());
+        assert(buffer[expected.size()] == 'x');
+
+        const auto too_small = to_chars(buffer, buffer + expected.size() - 1, x);
+        assert(too_small.ec == std::errc::value_too_large);
+    }
+}
+
+void run_iostream_tests()
+{
+    const auto format = [](auto value, auto... manipulators) {
+        std::ostringstream out;
+        (out << ... << manipulators) << value;
+        return out.str();
+    };
+
+    assert(format(u128_max) == "340282366920938463463374607431768211455");
+    assert(format(i128_min) == "-170141183460469231731687303715884105728");
+    assert(format(u128_max, std::hex) == "ffffffffffffffffffffffffffffffff");
+    assert(
+        format(u128_test, std::hex, std::uppercase, std::showbase) == "0X1999999999999999999999999"
+    );
+    assert(format(uint128_t(0), std::hex, std::showbase) == "0");
+    assert(format(uint128_t(8), std::oct, std::showbase) == "010");
+    assert(format(int128_t(-42), std::setw(8)) == "     -42");
+    assert(format(int128_t(-42), std::setw(8), std::left, std::setfill('*')) == "-42*****");
+    assert(format(int128_t(-42), std::setw(8), std::internal, std::setfill('0')) == "-0000042");
+    assert(format(int128_t(42), std::showpos) == "+42");
+    assert(format(uint128_t(42), std::showpos) == "42");
+
+    // Like std::num_put, negative values are written as their two's complement in hex and octal.
+    assert(format(-1LL, std::hex) == "ffffffffffffffff");
+    assert(format(int128_t(-1), std::hex) == "ffffffffffffffffffffffffffffffff");
+    assert(format(i128_min, std::hex, std::showbase) == "0x80000000000000000000000000000000");
+    assert(format(int128_t(-8), std::oct) == "3777777777777777777777777777777777777777770");
+    assert(format(int128_t(-8), std::oct, std::showpos) == format(int128_t(-8), std::oct));
+    // The octal base "0" is a digit, so internal padding goes before it.
+    const auto octal_internal = [&](const auto value) {
+        return format(
+            value, std::oct, std::showbase, std::internal, std::setw(6), std::setfill('*')
+        );
+    };
+    assert(octal_internal(int128_t(8)) == octal_internal(8LL));
+    assert(octal_internal(int128_t(8)) == "***010");
+    assert(format(int128_t(8), std::oct, std::showbase, std::internal, std::setw(6)) == "   010");
+    assert(format(int128_t(255), std::hex, std::showbase, std::internal, std::setw(6))
+           == format(255LL, std::hex, std::showbase, std::internal, std::setw(6)));
+
+    {
+        std::ostringstream out;
+        out << std::setw(5) << int128_t(1) << int128_t(2);
+        assert(out.str() == "    12");
+    }
+
+    {
+        std::istringstream in { "  340282366920938463463374607431768211455 "
+                                "-00000000000000000000000000000000000000000000000042 ff" };
+        uint128_t u {};
+        int128_t i {};
+        in >> u >> i;
+        assert(in);
+        assert(u == u128_max);
+        assert(i == -42);
+        in >> std::hex >> u;
+        assert(u == 255);
+        assert(in.eof());
+    }
+
+    {
+        std::istringstream in { "340282366920938463463374607431768211456" };
+        uint128_t u {};
+        in >> u;
+        assert(in.fail());
+        assert(u == u128_max);
+    }
+
+    {
+        // Like std::num_get, a minus sign wraps around for unsigned types.
+        std::istringstream in { "-1 -1 -ff -340282366920938463463374607431768211456" };
+        unsigned long long ull {};
+        uint128_t u {};
+        in >> ull >> u;
+        assert(ull == -1ULL);
+        assert(u == u128_max);
+        in >> std::hex >> u;
+        assert(u == uint128_t(-255));
+        in >> std::dec >> u;
+        assert(in.fail());
+        assert(u == u128_max);
+    }
+
+    {
+        std::istringstream in { "-170141183460469231731687303715884105729 x" };
+        int128_t i {};
+        in >> i;
+        assert(in.fail());
+        assert(i == i128_min);
+    }
+
+    {
+        std::istringstream in { "0x1F 017 abc" };
+        in.unsetf(std::ios_base::basefield);
+        int128_t a {};
+        int128_t b {};
+        int128_t c = 123;
+        in >> a >> b >> c;
+        assert(a == 31);
+        assert(b == 15);
+        assert(in.fail());
+        assert(c == 0);
+    }
+
+    // Like std::num_get, a "0x" prefix without any digits after it fails.
+    for (const char* const text : { "0x", "0xg", " 0x-1" }) {
+        for (const auto base : { std::ios_base::hex, std::ios_base::fmtflags {} }) {
+            std::istringstream expected_in { text };
+            std::istringstream in { text };
+            expected_in.setf(base, std::ios_base::basefield);
+            in.setf(base, std::ios_base::basefield);
+            long long expected = 123;
+            int128_t value = 123;
+            expected_in >> expected;
+            in >> value;
+            assert(in.fail());
+            assert(in.rdstate() == expected_in.rdstate());
+            assert(value == expected);
+        }
+    }
+}
+
 void run_fuzz_tests()
 {
     constexpr int iterations = 1'000'000;
@@ -177,6 +465,1280 @@ void run_fuzz_tests()
     }
 }
 
+void run_binary_tests()
+{
+    const auto parse = [](const std::string_view str, auto& value) {
+        return from_chars(str.data(), str.data() + str.size(), value, 2);
+    };
+
+    // Every length from 1 to 128 digits, compared against a bit-by-bit reference.
+    for (int width = 0; width <= 128; ++width) {
+        const uint128_t value
+            = width == 0 ? 0 : (u128_test * 7 >> (128 - width)) | uint128_t(1) << (width - 1);
+        std::string expected;
+        for (int i = 127; i >= 0; --i) {
+            if (value >> i != 0 || i == 0) {
+                expected.push_back(char('0' + int(value >> i & 1)));
+            }
+        }
+
+        char buffer[160];
+        const auto [p, ec] = to_chars(buffer, std::end(buffer), value, 2);
+        assert(ec == std::errc {});
+        assert(std::string_view(buffer, p) == expected);
+        assert(to_chars(buffer, buffer + expected.size() - 1, value, 2).ec
+               == std::errc::value_too_large);
+
+        // The parser has to stop at the first non-digit wherever it is within a block.
+        expected += "2101";
+        uint128_t parsed {};
+        const auto result = parse(expected, parsed);
+        assert(result.ec == std::errc {});
+        assert(result.ptr == expected.data() + expected.size() - 4);
+        assert(parsed == value);
+    }
+
+    uint128_t u128 {};
+    const std::string leading_zeros = std::string(200, '0') + "101";
+    auto result = parse(leading_zeros, u128);
+    assert(result.ec == std::errc {});
+    assert(result.ptr == leading_zeros.data() + leading_zeros.size());
+    assert(u128 == 5);
+
+    for (const std::size_t length : { 129, 130, 144, 145, 200 }) {
+        std::string too_large = "1";
+        too_large.append(length - 1, '0').append("x");
+        result = parse(too_large, u128);
+        assert(result.ec == std::errc::result_out_of_range);
+        assert(result.ptr == too_large.data() + length);
+    }
+
+    int128_t i128 {};
+    const std::string i128_min_str = "-1" + std::string(127, '0');
+    result = parse(i128_min_str, i128);
+    assert(result.ec == std::errc {});
+    assert(i128 == i128_min);
+    result = parse(std::string_view(i128_min_str).substr(1), i128);
+    assert(result.ec == std::errc::result_out_of_range);
+
+    const std::string_view not_binary = "2222222222222222222";
+    result = parse(not_binary, u128);
+    assert(result.ec == std::errc::invalid_argument);
+    assert(result.ptr == not_binary.data());
+}
+
+template <std::size_t N, bool Signed>
+void run_packed_round_trip(const std::vector<std::string_view>& values)
+{
+    std::string text;
+    for (const std::string_view value : values) {
+        text += value;
+        text += ',';
+    }
+    text.pop_back();
+
+    std::vector<std::byte> packed(packed_size<N>(values.size()));
+    const auto [ptr, count, ec]
+        = from_chars_packed<N, Signed>(text.data(), text.data() + text.size(), ',', packed);
+    assert(ec == std::errc {});
+    assert(ptr == text.data() + text.size());
+    assert(count == values.size());
+
+    char buffer[4096];
+    const auto [p, ec2] = to_chars_packed<N, Signed>(buffer, std::end(buffer), packed, count, ',');
+    assert(ec2 == std::errc {});
+    assert(std::string_view(buffer, p) == text);
+}
+
+void run_packed_tests()
+{
+    // 1, 2, 3 are packed as 0b011'010'001.
+    constexpr std::string_view small = "1;2;3";
+    std::byte bytes[2] { std::byte { 0xff }, std::byte { 0xff } };
+    auto result = from_chars_packed<3>(small.data(), small.data() + small.size(), ';', bytes);
+    assert(result.ec == std::errc {});
+    assert(result.count == 3);
+    assert(bytes[0] == std::byte { 0b11'010'001 });
+    assert(bytes[1] == std::byte { 0b0 });
+
+    run_packed_round_trip<1, false>({ "0", "1", "1", "0", "1", "0", "0", "1", "1" });
+    run_packed_round_trip<7, true>({ "-64", "63", "0", "-1", "17" });
+    run_packed_round_trip<64, false>({ "18446744073709551615", "0", "42" });
+    run_packed_round_trip<72, false>({ "4722366482869645213695", "1", "4722366482869645213694" });
+    run_packed_round_trip<96, true>({ "-39614081257132168796771975168", "-1", "7", "12345" });
+    run_packed_round_trip<100, false>({ "1267650600228229401496703205375", "0", "99", "3" });
+    run_packed_round_trip<100, true>({ "-633825300114114700748351602688", "5", "-5" });
+    run_packed_round_trip<128, true>({
+        "-170141183460469231731687303715884105728",
+        "170141183460469231731687303715884105727",
+        "0",
+    });
+
+    // Values have to fit into N bits.
+    std::byte packed[64];
+    constexpr std::string_view too_large = "1,1267650600228229401496703205376";
+    result = from_chars_packed<100>(
+        too_large.data(), too_large.data() + too_large.size(), ',', packed
+    );
+    assert(result.ec == std::errc::result_out_of_range);
+    assert(result.count == 1);
+    assert(result.ptr == too_large.data() + too_large.size());
+
+    constexpr std::string_view too_small = "-65";
+    result = from_chars_packed<7, true>(
+        too_small.data(), too_small.data() + too_small.size(), ',', packed
+    );
+    assert(result.ec == std::errc::result_out_of_range);
+    assert(result.count == 0);
+
+    // The output can run out of space, and parsing stops after the last delimited value.
+    constexpr std::string_view hex = "ff ff ff ff\n";
+    result = from_chars_packed<8>(
+        hex.data(), hex.data() + hex.size(), ' ', std::span(packed, 3), 16
+    );
+    assert(result.ec == std::errc::value_too_large);
+    assert(result.count == 3);
+    assert(*result.ptr == 'f');
+    result = from_chars_packed<8>(hex.data(), hex.data() + hex.size(), ' ', packed, 16);
+    assert(result.ec == std::errc {});
+    assert(result.count == 4);
+    assert(*result.ptr == '\n');
+
+    constexpr std::string_view dangling = "1,2,";
+    result = from_chars_packed<8>(dangling.data(), dangling.data() + dangling.size(), ',', packed);
+    assert(result.ec == std::errc::invalid_argument);
+    assert(result.count == 2);
+    assert(result.ptr == dangling.data() + dangling.size());
+
+    char buffer[8];
+    assert(to_chars_packed<8>(buffer, std::end(buffer), packed, 4, ',').ec
+           == std::errc::value_too_large);
+}
+
+void run_record_tests()
+{
+    using quote = record<field<uint128_t, 16>, field<int128_t>, field<uint32_t>, field<int, 2>>;
+    quote::value_type values {};
+    const auto parse = [&](const std::string_view str) {
+        return quote::from_chars(str.data(), str.data() + str.size(), values, '|');
+    };
+
+    constexpr std::string_view line
+        = "ffffffffffffffffffffffffffffffff|-170141183460469231731687303715884105728|7|-101\n";
+    auto result = parse(line);
+    assert(result.ec == std::errc {});
+    assert(*result.ptr == '\n');
+    assert(std::get<0>(values) == u128_max);
+    assert(std::get<1>(values) == i128_min);
+    assert(std::get<2>(values) == 7);
+    assert(std::get<3>(values) == -5);
+
+    char buffer[128];
+    const auto [p, ec] = quote::to_chars(buffer, std::end(buffer), values, '|');
+    assert(ec == std::errc {});
+    assert(std::string_view(buffer, p) == line.substr(0, line.size() - 1));
+    assert(quote::to_chars(buffer, buffer + 33, values, '|').ec == std::errc::value_too_large);
+
+    // On failure, the output is not modified.
+    const quote::value_type expected = values;
+    constexpr std::string_view missing_field = "ff|1|2";
+    result = parse(missing_field);
+    assert(result.ec == std::errc::invalid_argument);
+    assert(result.ptr == missing_field.data() + missing_field.size());
+    assert(values == expected);
+
+    constexpr std::string_view out_of_range = "ff|1|4294967296|0";
+    result = parse(out_of_range);
+    assert(result.ec == std::errc::result_out_of_range);
+    assert(*result.ptr == '|');
+    assert(values == expected);
+
+    constexpr std::string_view bad_digit = "ff|1|2|2";
+    result = parse(bad_digit);
+    assert(result.ec == std::errc::invalid_argument);
+    assert(result.ptr == bad_digit.data() + 7);
+
+    // Fields of every integer type are converted at their limits.
+    using limits = record<field<int8_t, 3>, field<int64_t>, field<uint64_t, 36>, field<int64_t, 8>>;
+    using i64 = std::numeric_limits<int64_t>;
+    const std::pair<limits::value_type, std::string_view> limit_lines[] {
+        { { int8_t(-128), i64::min(), 0, i64::min() },
+          "-11202,-9223372036854775808,0,-1000000000000000000000" },
+        { { int8_t(127), i64::max(), uint64_t(-1), i64::max() },
+          "11201,9223372036854775807,3w5e11264sgsf,777777777777777777777" },
+    };
+    for (const auto& [value, limit_line] : limit_lines) {
+        const auto [q, to_ec] = limits::to_chars(buffer, std::end(buffer), value, ',');
+        assert(to_ec == std::errc {});
+        assert(std::string_view(buffer, q) == limit_line);
+        limits::value_type parsed {};
+        const auto parsed_result = limits::from_chars(buffer, q, parsed, ',');
+        assert(parsed_result.ec == std::errc {} && parsed_result.ptr == q);
+        assert(parsed == value);
+    }
+    constexpr std::string_view too_small = "-11210,0,0,0";
+    limits::value_type parsed {};
+    const auto too_small_result
+        = limits::from_chars(too_small.data(), too_small.data() + too_small.size(), parsed, ',');
+    assert(too_small_result.ec == std::errc::result_out_of_range);
+    assert(too_small_result.ptr == too_small.data() + 6);
+}
+
+void run_decimal_column_tests()
+{
+    constexpr int128_t max_decimal = int128_t(detail::u128_pow10_table[38]) - 1;
+    const std::vector<int128_t> values { 12345, -5, 0, 777, max_decimal, -max_decimal, 100, 1 };
+    // Value 3 is null.
+    const std::byte validity[] { std::byte { 0b1111'0111 } };
+
+    std::vector<std::int32_t> offsets(values.size() + 1);
+    char data[512];
+    auto result = to_chars_decimal_column(data, std::end(data), values, validity, offsets, 2);
+    assert(result.ec == std::errc {});
+    assert(result.count == values.size());
+
+    const std::vector<std::string_view> expected {
+        "123.45",
+        "-0.05",
+        "0.00",
+        "",
+        "999999999999999999999999999999999999.99",
+        "-999999999999999999999999999999999999.99",
+        "1.00",
+        "0.01",
+    };
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        assert(std::string_view(data + offsets[i], data + offsets[i + 1]) == expected[i]);
+    }
+
+    std::vector<int128_t> parsed(values.size(), 42);
+    std::byte parsed_validity[1] {};
+    result = from_chars_decimal_column(data, offsets, parsed, parsed_validity, 38, 2);
+    assert(result.ec == std::errc {});
+    assert(parsed_validity[0] == validity[0]);
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        assert(parsed[i] == (i == 3 ? 0 : values[i]));
+    }
+
+    // Without a validity bitmap, no value is null, and scale 0 has no decimal point.
+    result = to_chars_decimal_column(data, std::end(data), values, {}, offsets, 0);
+    assert(result.ec == std::errc {});
+    assert(std::string_view(data + offsets[3], data + offsets[4]) == "777");
+    assert(std::string_view(data + offsets[5], data + offsets[6]) == "-" + std::string(38, '9'));
+
+    result = to_chars_decimal_column(data, std::end(data), values, {}, offsets, 38);
+    assert(result.ec == std::errc {});
+    assert(std::string_view(data + offsets[1], data + offsets[2])
+           == "-0.00000000000000000000000000000000000005");
+    result = from_chars_decimal_column(data, offsets, parsed, parsed_validity, 38, 38);
+    assert(result.ec == std::errc {});
+    assert(std::ranges::equal(parsed, values));
+
+    // The output runs out of space in the middle of the column.
+    result = to_chars_decimal_column(data, data + 20, values, validity, offsets, 2);
+    assert(result.ec == std::errc::value_too_large);
+    assert(result.count == 4);
+
+    std::vector<std::byte> cell_validity;
+    const auto parse_cells = [&](const std::vector<std::string_view>& cells, const int precision) {
+        std::string text;
+        std::vector<std::int32_t> cell_offsets { 0 };
+        for (const std::string_view cell : cells) {
+            text += cell;
+            cell_offsets.push_back(std::int32_t(text.size()));
+        }
+        parsed.resize(cells.size());
+        cell_validity.assign((cells.size() + 7) / 8, std::byte { 0xff });
+        return from_chars_decimal_column(
+            text.data(), cell_offsets, parsed, cell_validity, precision, 2
+        );
+    };
+
+    result = parse_cells({ "1.5", "-07", "", "0.250", "9999.99" }, 6);
+    assert(result.ec == std::errc {});
+    assert(parsed == std::vector<int128_t>({ 150, -700, 0, 25, 999999 }));
+
+    result = parse_cells({ "1", "10000.00" }, 6);
+    assert(result.ec == std::errc::result_out_of_range);
+    assert(result.count == 1);
+    assert(parse_cells({ "0.125" }, 6).ec == std::errc::result_out_of_range);
+    assert(parse_cells({ "1." }, 6).ec == std::errc::invalid_argument);
+    assert(parse_cells({ ".5" }, 6).ec == std::errc::invalid_argument);
+    assert(parse_cells({ "-" }, 6).ec == std::errc::invalid_argument);
+    assert(parse_cells({ "1 " }, 6).ec == std::errc::invalid_argument);
+    assert(parse_cells({ "1e3" }, 6).ec == std::errc::invalid_argument);
+
+    // An error in the middle of a validity byte still writes the bits before it.
+    result = parse_cells({ "1", "2", "3", "4", "5", "6", "7", "8", "9", "", "1", "x", "2" }, 6);
+    assert(result.ec == std::errc::invalid_argument);
+    assert(result.count == 11);
+    assert(cell_validity[0] == std::byte { 0xff });
+    assert(cell_validity[1] == std::byte { 0b1101 });
+}
+
+void run_divider_tests()
+{
+    std::mt19937_64 engine { 87 };
+    const auto random_u128 = [&] {
+        const uint128_t x = (uint128_t(engine()) << 64) | engine();
+        return x >> (engine() % 128);
+    };
+
+    constexpr uint128_t two_64 = uint128_t(1) << 64;
+    std::vector<uint128_t> dividends { 0, 1, two_64 - 1, two_64, u128_max };
+    for (int i = 0; i < 64; ++i) {
+        dividends.push_back(random_u128());
+    }
+
+    std::vector<uint64_t> divisors_64 { 1, 2, 3, 7, 10, uint64_t(-1) };
+    divisors_64.insert(divisors_64.end(), { 1ull << 63, (1ull << 63) + 1 });
+    for (int base = 2; base <= 36; ++base) {
+        const uint64_t max_pow = detail::u64_max_power(base);
+        divisors_64.push_back(max_pow == 0 ? uint64_t(base) : max_pow);
+    }
+    for (int i = 0; i < 200; ++i) {
+        divisors_64.push_back(uint64_t(random_u128()) | 1);
+    }
+    for (const uint64_t d : divisors_64) {
+        const divider<uint64_t> divider_64 { d };
+        const divider<uint128_t> divider_128 { d };
+        for (const uint128_t x : dividends) {
+            const auto [quotient, remainder] = divider_64.divmod(x);
+            assert(quotient == x / d);
+            assert(remainder == x % d);
+            assert(x / divider_128 == x / d);
+            assert(x % divider_128 == x % d);
+        }
+    }
+
+    std::vector<uint128_t> divisors_128 {
+        two_64,
+        two_64 + 1,
+        uint128_t(1) << 127,
+        (uint128_t(1) << 127) + 1,
+        u128_max,
+        u128_max - 1,
+        u128_test,
+        detail::u128_pow10_table[20],
+        detail::u128_pow10_table[38],
+    };
+    for (int i = 0; i < 200; ++i) {
+        divisors_128.push_back(random_u128() | two_64);
+    }
+    for (const uint128_t d : divisors_128) {
+        const divider<uint128_t> divider_128 { d };
+        assert(divider_128.divisor() == d);
+        for (uint128_t x : dividends) {
+            const auto [quotient, remainder] = divider_128.divmod(x);
+            assert(quotient == x / d);
+            assert(remainder == x % d);
+            // Dividends close to multiples of the divisor are the most likely to be off by one.
+            for (const uint128_t near : { x / d * d, x / d * d - 1 }) {
+                assert(near / divider_128 == near / d);
+            }
+        }
+    }
+}
+
+static_assert([] {
+    constexpr divider<uint128_t> d { detail::u128_pow10_table[30] + 7 };
+    return u128_max / d == u128_max / (detail::u128_pow10_table[30] + 7);
+}());
+
+template <typename T>
+std::string format_exact(const T value, const std::chars_format fmt)
+{
+    char buffer[20000];
+    const auto [p, ec] = to_chars_exact(buffer, std::end(buffer), value, fmt);
+    assert(ec == std::errc {});
+    return std::string(buffer, p);
+}
+
+void run_exact_float_tests()
+{
+    constexpr auto fixed = std::chars_format::fixed;
+    constexpr auto scientific = std::chars_format::scientific;
+
+    assert(format_exact(0.1, fixed) == "0.1000000000000000055511151231257827021181583404541015625");
+    assert(
+        format_exact(0.1, scientific)
+        == "1.000000000000000055511151231257827021181583404541015625e-01"
+    );
+    assert(format_exact(1e23, fixed) == "99999999999999991611392");
+    assert(format_exact(1e23, scientific) == "9.9999999999999991611392e+22");
+    assert(format_exact(1e22, fixed) == "10000000000000000000000");
+    assert(format_exact(1e22, scientific) == "1e+22");
+    assert(format_exact(-2.5, fixed) == "-2.5");
+    assert(format_exact(-2.5, scientific) == "-2.5e+00");
+    assert(format_exact(123456789.0, scientific) == "1.23456789e+08");
+    assert(
+        format_exact(1e-5, scientific)
+        == "1.0000000000000000818030539140313095458623138256371021270751953125e-05"
+    );
+    assert(format_exact(0.0, fixed) == "0");
+    assert(format_exact(-0.0, scientific) == "-0e+00");
+    assert(format_exact(std::numeric_limits<double>::infinity(), fixed) == "inf");
+    assert(format_exact(-std::numeric_limits<double>::infinity(), scientific) == "-inf");
+    assert(format_exact(std::numeric_limits<double>::quiet_NaN(), fixed) == "nan");
+    assert(
+        format_exact(0.1L, fixed)
+        == (std::numeric_limits<long double>::digits == 64
+                ? "0.1000000000000000000013552527156068805425093160010874271392822265625"
+                : format_exact(double(0.1L), fixed))
+    );
+
+    // The smallest subnormal has 1074 fractional digits, and 751 of them are significant.
+    const std::string denorm_min = format_exact(std::numeric_limits<double>::denorm_min(), fixed);
+    assert(denorm_min.size() == 2 + 1074);
+    assert(denorm_min.starts_with("0." + std::string(323, '0') + "49406564584124654"));
+    assert(denorm_min.ends_with("5"));
+    const std::string denorm_min_scientific
+        = format_exact(std::numeric_limits<double>::denorm_min(), scientific);
+    assert(denorm_min_scientific.size() == 751 + 1 + 5);
+    assert(denorm_min_scientific.starts_with("4.9406564584124654"));
+    assert(denorm_min_scientific.ends_with("5e-324"));
+    assert(format_exact(std::numeric_limits<double>::max(), fixed).size() == 309);
+
+    // Every output is exact, so it has to be parsed back to the same value.
+    const auto round_trip = [&]<typename T>(const T value) {
+        for (const auto fmt : { fixed, scientific }) {
+            const std::string text = format_exact(value, fmt);
+            T parsed {};
+            const char* const end = text.data() + text.size();
+            const auto [p, ec] = std::from_chars(text.data(), end, parsed, fmt);
+            assert(ec == std::errc {});
+            assert(p == end);
+            assert(parsed == value);
+        }
+    };
+    std::mt19937_64 engine { 88 };
+    for (int i = 0; i < 2000; ++i) {
+        const auto value = std::bit_cast<double>(engine());
+        if (std::isfinite(value)) {
+            round_trip(value);
+            round_trip((long double)(value) * (long double)(engine() % 1000));
+        }
+    }
+    round_trip(std::numeric_limits<long double>::max());
+    round_trip(std::numeric_limits<long double>::denorm_min());
+
+    char small[8];
+    assert(to_chars_exact(small, std::end(small), 0.1).ec == std::errc::value_too_large);
+    assert(to_chars_exact(small, small + 8, 1e23, scientific).ec == std::errc::value_too_large);
+    assert(to_chars_exact(small, small + 4, 1e22, scientific).ec == std::errc::value_too_large);
+    assert(to_chars_exact(small, small + 5, 1e22, scientific).ec == std::errc {});
+}
+
+void run_adaptive_tests()
+{
+    const auto parse = [](const std::string_view text, const int base = 10) {
+        adaptive_integer result = overflow_digits { 0 };
+        const char* const end = text.data() + text.size();
+        const auto [p, ec] = from_chars_adaptive(text.data(), end, result, base);
+        assert(ec == std::errc {});
+        assert(p == end);
+        return result;
+    };
+    constexpr auto i64_max = std::numeric_limits<std::int64_t>::max();
+    constexpr auto i64_min = std::numeric_limits<std::int64_t>::min();
+    constexpr auto i128_max = int128_t(u128_max >> 1);
+
+    assert(parse("0") == adaptive_integer { std::int64_t(0) });
+    assert(parse("-0") == adaptive_integer { std::int64_t(0) });
+    assert(parse("000000000000000000000000042") == adaptive_integer { std::int64_t(42) });
+    assert(parse("9223372036854775807") == adaptive_integer { i64_max });
+    assert(parse("-9223372036854775808") == adaptive_integer { i64_min });
+    assert(parse("9223372036854775808") == adaptive_integer { int128_t(i64_max) + 1 });
+    assert(parse("-9223372036854775809") == adaptive_integer { int128_t(i64_min) - 1 });
+    assert(parse("18446744073709551616") == adaptive_integer { int128_t(1) << 64 });
+    assert(parse("170141183460469231731687303715884105727") == adaptive_integer { i128_max });
+    assert(parse("-170141183460469231731687303715884105728") == adaptive_integer { i128_min });
+    assert(
+        parse("170141183460469231731687303715884105728")
+        == adaptive_integer { overflow_digits { 39 } }
+    );
+    assert(parse("-00" + std::string(100, '9')) == adaptive_integer { overflow_digits { 100 } });
+
+    // 13 digits in base 36 don't always fit into std::uint64_t, but this value fits into int64_t.
+    assert(parse("1y2p0ij32e8e7", 36) == adaptive_integer { i64_max });
+    assert(parse("1y2p0ij32e8e8", 36) == adaptive_integer { int128_t(i64_max) + 1 });
+    assert(parse("-ff", 16) == adaptive_integer { std::int64_t(-255) });
+
+    adaptive_integer result = std::int64_t(7);
+    constexpr std::string_view invalid[] = { "", "-", "x", "-+1", "+1" };
+    for (const std::string_view text : invalid) {
+        const char* const end = text.data() + text.size();
+        const auto [p, ec] = from_chars_adaptive(text.data(), end, result);
+        assert(ec == std::errc::invalid_argument);
+        assert(p == text.data());
+        assert(result == adaptive_integer { std::int64_t(7) });
+    }
+    const std::string_view trailing = "123,456";
+    const auto [p, ec]
+        = from_chars_adaptive(trailing.data(), trailing.data() + trailing.size(), result);
+    assert(ec == std::errc {});
+    assert(p == trailing.data() + 3);
+}
+
+template <std::size_t N>
+void run_bitset_round_trip(std::mt19937_64& engine)
+{
+    std::bitset<N> value;
+    for (std::size_t i = 0; i < N; ++i) {
+        value[i] = engine() % 2 != 0;
+    }
+    const std::string binary = value.to_string();
+    // Every hexadecimal digit is formed from four bits of the zero-extended binary string.
+    const std::string padded = std::string((4 - N % 4) % 4, '0') + binary;
+    std::string hex;
+    for (std::size_t i = 0; i < padded.size(); i += 4) {
+        hex += detail::digit_chars[std::stoi(padded.substr(i, 4), nullptr, 2)];
+    }
+
+    for (const auto& [base, expected] : { std::pair { 2, binary }, std::pair { 16, hex } }) {
+        char buffer[4200];
+        const auto [p, ec] = to_chars(buffer, std::end(buffer), value, base);
+        assert(ec == std::errc {});
+        assert(std::string_view(buffer, p) == expected);
+        assert(to_chars(buffer, buffer + expected.size() - 1, value, base).ec
+               == std::errc::value_too_large);
+
+        std::bitset<N> parsed;
+        const std::string input = "000" + expected + "x";
+        const char* const end = input.data() + input.size();
+        const auto result = from_chars(input.data(), end, parsed, base);
+        assert(result.ec == std::errc {});
+        assert(result.ptr == end - 1);
+        assert(parsed == value);
+    }
+}
+
+void run_bitset_tests()
+{
+    std::mt19937_64 engine { 90 };
+    for (int i = 0; i < 20; ++i) {
+        run_bitset_round_trip<1>(engine);
+        run_bitset_round_trip<7>(engine);
+        run_bitset_round_trip<64>(engine);
+        run_bitset_round_trip<100>(engine);
+        run_bitset_round_trip<256>(engine);
+        run_bitset_round_trip<4096>(engine);
+    }
+
+    std::bitset<6> value { 0b101010 };
+    const auto parse = [&](const std::string_view text, const int base) {
+        return from_chars(text.data(), text.data() + text.size(), value, base);
+    };
+    assert(parse("3f", 16).ec == std::errc {});
+    assert(value.to_ulong() == 0x3f);
+    assert(parse("40", 16).ec == std::errc::result_out_of_range);
+    assert(parse("1000000", 2).ec == std::errc::result_out_of_range);
+    assert(parse("1" + std::string(200, '0') + "1", 2).ec == std::errc::result_out_of_range);
+    assert(parse("g", 16).ec == std::errc::invalid_argument);
+    assert(value.to_ulong() == 0x3f);
+    assert(parse(std::string(200, '0') + "101", 2).ec == std::errc {});
+    assert(value.to_ulong() == 0b101);
+
+    // Every character next to a digit range has to end the digits,
+    // both in blocks of sixteen characters and in the scalar tail.
+    std::bitset<256> wide;
+    for (const char c : { '/', ':', '@', 'G', '`', 'g', '\x10', '\x19', '\x80' }) {
+        for (const std::size_t position : { 5, 20, 62 }) {
+            std::string text(64, 'F');
+            text[position] = c;
+            const auto [p, ec] = from_chars(text.data(), text.data() + text.size(), wide, 16);
+            assert(ec == std::errc {});
+            assert(p == text.data() + position);
+            assert(wide.count() == 4 * position);
+        }
+    }
+    const std::string mixed_case = "0123456789abcdefABCDEF";
+    assert(from_chars(mixed_case.data(), mixed_case.data() + 22, wide, 16).ec == std::errc {});
+    char buffer[64];
+    const auto [p, ec] = to_chars(buffer, std::end(buffer), wide, 16);
+    assert(ec == std::errc {});
+    assert(std::string_view(buffer, p).ends_with("0123456789abcdefabcdef"));
+}
+
+/// @brief Returns the bytes for a string of hexadecimal digits, such as `"12345c"`.
+std::vector<std::byte> hex_bytes(const std::string_view hex)
+{
+    std::vector<std::byte> result;
+    for (std::size_t i = 0; i < hex.size(); i += 2) {
+        result.push_back(std::byte(std::stoi(std::string(hex.substr(i, 2)), nullptr, 16)));
+    }
+    return result;
+}
+
+/// @brief Returns the packed and the zoned decimal bytes of `value` with `digits` digits,
+/// built one digit at a time.
+std::pair<std::vector<std::byte>, std::vector<std::byte>>
+reference_decimal_bytes(const int128_t value, const std::size_t digits)
+{
+    char buffer[64];
+    const uint128_t magnitude = value < 0 ? -uint128_t(value) : uint128_t(value);
+    const auto [p, ec] = to_chars(buffer, std::end(buffer), magnitude);
+    assert(ec == std::errc {});
+    const std::string text
+        = std::string(digits - std::size_t(p - buffer), '0') + std::string(buffer, p);
+    const char sign = value < 0 ? 'd' : 'c';
+
+    std::string zoned_hex;
+    for (const char c : text) {
+        zoned_hex += 'f';
+        zoned_hex += c;
+    }
+    zoned_hex[zoned_hex.size() - 2] = sign;
+    return { hex_bytes(text + sign), hex_bytes(zoned_hex) };
+}
+
+void run_packed_decimal_tests()
+{
+    const auto parse_packed = [](const std::string_view hex, int128_t& value) {
+        return from_packed_bcd(hex_bytes(hex), value);
+    };
+    const auto parse_zoned = [](const std::string_view hex, int128_t& value) {
+        return from_zoned_decimal(hex_bytes(hex), value);
+    };
+
+    int128_t value = 0;
+    assert(parse_packed("12345c", value) == std::errc {});
+    assert(value == 12345);
+    assert(parse_packed("12345d", value) == std::errc {});
+    assert(value == -12345);
+    assert(parse_packed("0f", value) == std::errc {});
+    assert(value == 0);
+    assert(parse_packed("0d", value) == std::errc {});
+    assert(value == 0);
+    assert(parse_packed("9999999999999999999999999999999c", value) == std::errc {});
+    assert(value == detail::u128_pow10_table[31] - 1);
+    assert(parse_packed("00000000000000000000001234567890123c", value) == std::errc {});
+    assert(value == 1234567890123);
+    // 39 digits, just at the limits of int128_t.
+    assert(parse_packed("170141183460469231731687303715884105727c", value) == std::errc {});
+    assert(value == int128_t(u128_max >> 1));
+    assert(parse_packed("170141183460469231731687303715884105728d", value) == std::errc {});
+    assert(value == i128_min);
+    value = 7;
+    assert(parse_packed("170141183460469231731687303715884105728c", value)
+           == std::errc::result_out_of_range);
+    assert(parse_packed("999999999999999999999999999999999999999999999d", value)
+           == std::errc::result_out_of_range);
+    assert(parse_packed("12a45c", value) == std::errc::invalid_argument);
+    assert(parse_packed("12345", value) == std::errc::invalid_argument);
+    assert(parse_packed("123459", value) == std::errc::invalid_argument);
+    assert(parse_packed("f0000000000000000000000000000000000c", value)
+           == std::errc::invalid_argument);
+    assert(parse_packed("", value) == std::errc::invalid_argument);
+    assert(value == 7);
+
+    assert(parse_zoned("f1f2c3", value) == std::errc {});
+    assert(value == 123);
+    assert(parse_zoned("f1f2d3", value) == std::errc {});
+    assert(value == -123);
+    assert(parse_zoned("f0f0f0f0f0f0f0f0f0f0f0f0f0f0f0f0f0f0f0f0f0f9", value) == std::errc {});
+    assert(value == 9);
+    value = 7;
+    assert(parse_zoned("f1f2e3", value) == std::errc {});
+    assert(value == 123);
+    assert(parse_zoned("f1f2a3", value) == std::errc {});
+    assert(parse_zoned("f1f2b3", value) == std::errc {});
+    assert(value == -123);
+    value = 7;
+    assert(parse_zoned("f1f253", value) == std::errc::invalid_argument);
+    assert(parse_zoned("f1e2c3", value) == std::errc::invalid_argument);
+    assert(parse_zoned("f1fac3", value) == std::errc::invalid_argument);
+    assert(parse_zoned("f1f2cb", value) == std::errc::invalid_argument);
+    assert(parse_zoned("f1f2f3f4f5f6f7fafaf1f2c3", value) == std::errc::invalid_argument);
+    assert(parse_zoned("f1f2f3f4f5f6f7e8f1f2c3", value) == std::errc::invalid_argument);
+    assert(value == 7);
+
+    std::mt19937_64 engine { 91 };
+    for (int i = 0; i < 2000; ++i) {
+        const auto digits = std::size_t(1 + engine() % 45);
+        const uint128_t bound
+            = digits >= 39 ? uint128_t(1) << 127 : detail::u128_pow10_table[digits] - 1;
+        const uint128_t random = (uint128_t(engine()) << 64) | engine();
+        const uint128_t magnitude = (random >> (engine() % 128)) % bound;
+        const int128_t expected = engine() % 2 != 0 ? -int128_t(magnitude) : int128_t(magnitude);
+
+        const auto [packed, zoned] = reference_decimal_bytes(expected, digits | 1);
+        std::vector<std::byte> output(packed.size());
+        assert(to_packed_bcd(output, expected) == std::errc {});
+        assert(output == packed);
+        assert(from_packed_bcd(packed, value) == std::errc {});
+        assert(value == expected);
+
+        const auto zoned_reference = reference_decimal_bytes(expected, digits).second;
+        output.assign(zoned_reference.size(), std::byte {});
+        assert(to_zoned_decimal(output, expected) == std::errc {});
+        assert(output == zoned_reference);
+        assert(from_zoned_decimal(zoned_reference, value) == std::errc {});
+        assert(value == expected);
+    }
+
+    std::vector<std::byte> small(3);
+    assert(to_packed_bcd(small, 99999) == std::errc {});
+    assert(to_packed_bcd(small, -100000) == std::errc::value_too_large);
+    assert(to_zoned_decimal(small, -999) == std::errc {});
+    assert(to_zoned_decimal(small, 1000) == std::errc::value_too_large);
+    std::vector<std::byte> wide(20);
+    assert(to_packed_bcd(wide, i128_min) == std::errc {});
+    assert(from_packed_bcd(wide, value) == std::errc {});
+    assert(value == i128_min);
+}
+
+// Every backend is usable in constant expressions.
+static_assert([] {
+    char buffer[64] {};
+    const auto [p, ec] = basic_converter<backend::constant_time>::to_chars(
+        buffer, std::end(buffer), i128_min, 10
+    );
+    int128_t value {};
+    const auto parsed = basic_converter<backend::constant_time>::from_chars(buffer, p, value);
+    return ec == std::errc {} && parsed.ptr == p && value == i128_min
+        && std::string_view(buffer, p) == "-170141183460469231731687303715884105728";
+}());
+
+static_assert([] {
+    char buffer[64] {};
+    const auto [p, ec]
+        = basic_converter<backend::scalar>::to_chars(buffer, std::end(buffer), u128_max, 36);
+    uint128_t value {};
+    const auto parsed = basic_converter<backend::scalar>::from_chars(buffer, p, value, 36);
+    return ec == std::errc {} && parsed.ptr == p && value == u128_max
+        && std::string_view(buffer, p) == "f5lxx1zz5pnorynqglhzmsp33";
+}());
+
+/// @brief Checks that the converter produces the same results as the free functions.
+template <backend Backend>
+void run_converter_tests()
+{
+    using converter = basic_converter<Backend>;
+    if constexpr (converter::available) {
+        if (!converter::supported()) {
+            return;
+        }
+        std::mt19937_64 engine { 92 };
+        std::vector<uint128_t> values { 0, 1, 9, 10, uint64_t(-1), uint128_t(uint64_t(-1)) + 1 };
+        values.insert(values.end(), { u128_test, u128_max, u128_max - 1, uint128_t(i128_min) });
+        for (int i = 0; i < 200; ++i) {
+            const uint128_t x = (uint128_t(engine()) << 64) | engine();
+            values.push_back(x >> (engine() % 128));
+        }
+
+        for (int base = 2; base <= 36; ++base) {
+            for (const uint128_t x : values) {
+                char expected[160];
+                char actual[160];
+                const auto e = to_chars(expected, std::end(expected), x, base);
+                const auto a = converter::to_chars(actual, std::end(actual), x, base);
+                assert(a.ec == std::errc {});
+                assert(std::string_view(actual, a.ptr) == std::string_view(expected, e.ptr));
+
+                const auto too_small = converter::to_chars(actual, a.ptr - 1, x, base);
+                assert(too_small.ec == std::errc::value_too_large);
+
+                uint128_t parsed {};
+                const auto p = converter::from_chars(actual, a.ptr, parsed, base);
+                assert(p.ec == std::errc {} && p.ptr == a.ptr && parsed == x);
+
+                const auto e_signed = to_chars(expected, std::end(expected), int128_t(x), base);
+                const auto a_signed
+                    = converter::to_chars(actual, std::end(actual), int128_t(x), base);
+                assert(
+                    std::string_view(actual, a_signed.ptr)
+                    == std::string_view(expected, e_signed.ptr)
+                );
+
+                int128_t parsed_signed {};
+                const auto p_signed
+                    = converter::from_chars(actual, a_signed.ptr, parsed_signed, base);
+                assert(p_signed.ec == std::errc {} && parsed_signed == int128_t(x));
+            }
+        }
+
+        const std::string leading_zeros(1000, '0');
+        const std::string inputs[] {
+            "",
+            "-",
+            "+1",
+            " 1",
+            "12z",
+            "-0",
+            "340282366920938463463374607431768211455",
+            "340282366920938463463374607431768211456",
+            "3402823669209384634633746074317682114550",
+            "170141183460469231731687303715884105727",
+            "170141183460469231731687303715884105728",
+            "-170141183460469231731687303715884105728",
+            "-170141183460469231731687303715884105729",
+            leading_zeros + "123",
+            "-" + leading_zeros + "1",
+            "zzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",
+            "ZZZZZZZZZZZZZZZZZZZZZZZZZ",
+            std::string(129, '1'),
+        };
+        for (const std::string& input : inputs) {
+            for (const int base : { 2, 10, 16, 36 }) {
+                const char* const first = input.data();
+                const char* const last = first + input.size();
+                uint128_t expected = 1;
+                uint128_t actual = 1;
+                const auto e = from_chars(first, last, expected, base);
+                const auto a = converter::from_chars(first, last, actual, base);
+                assert(a.ec == e.ec && a.ptr == e.ptr && actual == expected);
+
+                int128_t expected_signed = 1;
+                int128_t actual_signed = 1;
+                const auto e_signed = from_chars(first, last, expected_signed, base);
+                const auto a_signed = converter::from_chars(first, last, actual_signed, base);
+                assert(a_signed.ec == e_signed.ec && a_signed.ptr == e_signed.ptr);
+                assert(actual_signed == expected_signed);
+            }
+        }
+    }
+}
+
+void run_backend_tests()
+{
+    static_assert(basic_converter<backend::scalar>::available);
+    static_assert(basic_converter<backend::constant_time>::available);
+
+    run_converter_tests<backend::automatic>();
+    run_converter_tests<backend::scalar>();
+    run_converter_tests<backend::swar>();
+    run_converter_tests<backend::sse>();
+    run_converter_tests<backend::avx2>();
+    run_converter_tests<backend::avx512>();
+    run_converter_tests<backend::constant_time>();
+}
+
+static_assert([] {
+    char buffer[8] { '9', '9', '9' };
+    const auto [p, ec] = increment_chars(buffer, buffer + 3, std::end(buffer), 10);
+    return ec == std::errc {} && std::string_view(buffer, p) == "1000";
+}());
+
+void run_increment_tests()
+{
+    const auto increment = [](std::string text, const int base, const uint64_t delta) {
+        const std::size_t length = text.size();
+        text.resize(length + 64, '_');
+        char* const first = text.data();
+        char* const last = first + length;
+        const auto [p, ec] = increment_chars(first, last, first + text.size(), base, delta);
+        assert(ec == std::errc {});
+        return text.substr(0, std::size_t(p - first));
+    };
+    assert(increment("0", 10, 1) == "1");
+    assert(increment("9", 10, 1) == "10");
+    assert(increment("5", 10, 1000) == "1005");
+    assert(increment("12345678", 10, 1) == "12345679");
+    assert(increment("12345679", 10, 1) == "12345680");
+    assert(increment("99999999", 10, 1) == "100000000");
+    assert(increment("1099999999", 10, 1) == "1100000000");
+    assert(increment(std::string(32, 'f'), 16, 1) == "1" + std::string(32, '0'));
+    assert(increment("18446744073709551615", 10, uint64_t(-1)) == "36893488147419103230");
+    assert(increment("0", 2, uint64_t(-1)) == std::string(64, '1'));
+    assert(increment("zz", 36, 0) == "zz");
+    assert(increment("ZZ", 36, 1) == "100");
+    // Letters keep the case of the text, on every path.
+    assert(increment("ZZZZZZZA", 36, 1) == "ZZZZZZZB");
+    assert(increment("ZZZZZZAZ", 36, 1) == "ZZZZZZB0");
+    assert(increment("AFFFFFFFF", 16, 1) == "B00000000");
+    assert(increment("FFFFFFFFF", 16, 0xB000000000) == "BFFFFFFFFF");
+    assert(increment("A0000009", 16, 1) == "A000000A");
+    assert(increment("A0000009", 16, 0x11) == "A000001A");
+    assert(increment("Fz9", 36, 1) == "Fza");
+    assert(increment("9", 16, 1) == "a");
+    assert(increment("", 10, 42) == "42");
+
+    std::mt19937_64 engine { 94 };
+    for (int i = 0; i < 100'000; ++i) {
+        const int base = int(2 + engine() % 35);
+        const uint128_t x = ((uint128_t(engine()) << 64) | engine()) >> (engine() % 128);
+        const uint64_t delta = engine() >> (engine() % 64);
+        if (x > u128_max - delta) {
+            continue;
+        }
+        char buffer[160];
+        char expected[160];
+        const auto [p, ec] = to_chars(buffer, std::end(buffer), x, base);
+        const auto e = to_chars(expected, std::end(expected), x + delta, base);
+        const auto a = increment_chars(buffer, p, std::end(buffer), base, delta);
+        assert(a.ec == std::errc {});
+        assert(std::string_view(buffer, a.ptr) == std::string_view(expected, e.ptr));
+    }
+
+    // Without space to grow, nothing is modified.
+    char buffer[] = "999";
+    const auto [p, ec] = increment_chars(buffer, buffer + 3, buffer + 3, 10);
+    assert(ec == std::errc::value_too_large && p == buffer + 3);
+    assert(std::string_view(buffer) == "999");
+}
+
+static_assert([] {
+    char buffer[64] {};
+    const auto [p, ec] = to_chars_sortable(buffer, std::end(buffer), int128_t(-42));
+    int128_t value {};
+    const auto parsed = from_chars_sortable(buffer, p, value);
+    return ec == std::errc {} && std::string_view(buffer, p) == "N57" && parsed.ptr == p
+        && value == -42;
+}());
+
+template <typename T>
+std::string format_sortable(const T value, const int base)
+{
+    char buffer[160];
+    const auto [p, ec] = to_chars_sortable(buffer, std::end(buffer), value, base);
+    assert(ec == std::errc {});
+    return std::string(buffer, p);
+}
+
+void run_sortable_tests()
+{
+    assert(format_sortable(uint128_t(0), 10) == "P0");
+    assert(format_sortable(uint128_t(7), 10) == "P7");
+    assert(format_sortable(uint128_t(42), 10) == "Q42");
+    assert(format_sortable(int128_t(-1), 10) == "O8");
+    assert(format_sortable(int128_t(-10), 10) == "N89");
+    assert(format_sortable(u128_max, 10) == "v340282366920938463463374607431768211455");
+    assert(format_sortable(i128_min, 10) == ")829858816539530768268312696284115894271");
+    assert(format_sortable(uint128_t(255), 16) == "Qff");
+
+    std::mt19937_64 engine { 95 };
+    for (const int base : { 2, 3, 6, 7, 10, 16, 36 }) {
+        std::vector<int128_t> values { 0, 1, -1, int128_t(u128_max >> 1), i128_min };
+        for (int i = 0; i < 2000; ++i) {
+            const auto x = int128_t(((uint128_t(engine()) << 64) | engine()) >> (engine() % 128));
+            values.push_back(engine() % 2 == 0 ? x : -x);
+        }
+        std::ranges::sort(values);
+
+        std::vector<std::string> texts;
+        for (const int128_t x : values) {
+            texts.push_back(format_sortable(x, base));
+            const std::string& text = texts.back();
+
+            const char* const last = text.data() + text.size();
+            int128_t parsed {};
+            const auto [p, ec] = from_chars_sortable(text.data(), last, parsed, base);
+            assert(ec == std::errc {} && p == last && parsed == x);
+
+            uint128_t parsed_unsigned {};
+            const auto result = from_chars_sortable(text.data(), last, parsed_unsigned, base);
+            if (x >= 0) {
+                assert(result.ec == std::errc {} && parsed_unsigned == uint128_t(x));
+                assert(format_sortable(uint128_t(x), base) == text);
+            }
+            else {
+                assert(result.ec == std::errc::result_out_of_range);
+            }
+        }
+        // std::string compares characters as unsigned char.
+        assert(std::ranges::is_sorted(texts));
+    }
+
+    const auto parse_error = [](const std::string_view text, const int base = 10) {
+        int128_t value = 1;
+        const auto [p, ec]
+            = from_chars_sortable(text.data(), text.data() + text.size(), value, base);
+        assert(ec == std::errc {} || value == 1);
+        return ec;
+    };
+    assert(parse_error("") == std::errc::invalid_argument);
+    assert(parse_error("Q4") == std::errc::invalid_argument);
+    assert(parse_error("Q422") == std::errc {});
+    assert(parse_error("Q04") == std::errc::invalid_argument);
+    assert(parse_error("Q4x") == std::errc::invalid_argument);
+    assert(parse_error("Qff", 16) == std::errc {});
+    assert(parse_error("QFF", 16) == std::errc::invalid_argument);
+    assert(parse_error("Qfa", 16) == std::errc {});
+    assert(parse_error("N00", 16) == std::errc {});
+    assert(parse_error("N0A", 16) == std::errc::invalid_argument);
+    assert(parse_error("O9") == std::errc::invalid_argument);
+    assert(parse_error("N98") == std::errc::invalid_argument);
+    assert(parse_error("w3402823669209384634633746074317682114550") == std::errc::invalid_argument);
+    assert(parse_error("v340282366920938463463374607431768211455")
+           == std::errc::result_out_of_range);
+    assert(parse_error(")829858816539530768268312696284115894270")
+           == std::errc::result_out_of_range);
+}
+
+static_assert(max_chars<uint128_t>() == 39);
+static_assert(max_chars<int128_t>() == 40);
+static_assert(max_chars<uint128_t>(2) == 128);
+static_assert(max_chars<int128_t>(2) == 129);
+static_assert(max_chars<int128_t>(16) == 33);
+static_assert(max_chars<uint64_t>() == 20);
+static_assert(max_chars<int8_t>() == 4);
+
+/// @brief Returns everything that was written to `file` through its file descriptor.
+std::string read_file(std::FILE* const file)
+{
+    const int fd = fileno(file);
+    std::string result;
+    char buffer[4096];
+    assert(lseek(fd, 0, SEEK_SET) == 0);
+    for (ssize_t n; (n = read(fd, buffer, sizeof(buffer))) > 0;) {
+        result.append(buffer, std::size_t(n));
+    }
+    return result;
+}
+
+template <typename T>
+constexpr bool can_write = requires(fd_writer& writer, T value) { writer.write(value); };
+static_assert(can_write<int128_t>);
+static_assert(can_write<char>);
+static_assert(!can_write<bool>);
+
+void run_fd_writer_tests()
+{
+    std::FILE* const file = std::tmpfile();
+    assert(file);
+    std::string expected;
+    {
+        fd_writer writer { fileno(file), 1 };
+        assert(writer.capacity() >= 4096 && writer.capacity() % 4096 == 0);
+
+        std::mt19937_64 engine { 96 };
+        char buffer[160];
+        for (int i = 0; i < 20'000; ++i) {
+            const auto x = int128_t(((uint128_t(engine()) << 64) | engine()) >> (engine() % 128));
+            const int base = i % 100 == 0 ? 2 : 10;
+            assert(writer.write(x, ",", base) == std::errc {});
+            assert(writer.size() <= writer.capacity());
+            const auto [p, ec] = to_chars(buffer, std::end(buffer), x, base);
+            expected.append(buffer, p);
+            expected += ',';
+        }
+        assert(writer.write(uint64_t(42), "\n") == std::errc {});
+        expected += "42\n";
+
+        // Text which doesn't fit into the buffer is written together with it.
+        const std::string large(3 * writer.capacity(), 'x');
+        assert(writer.write(large) == std::errc {});
+        assert(writer.size() == 0);
+        expected += large;
+        assert(writer.write(u128_max) == std::errc {});
+        expected += "340282366920938463463374607431768211455";
+    }
+    assert(read_file(file) == expected);
+    std::fclose(file);
+
+    fd_writer invalid { -1 };
+    assert(invalid.write(int128_t(1), "\n") == std::errc {});
+    assert(invalid.flush() == std::errc::bad_file_descriptor);
+    assert(invalid.write(int128_t(1)) == std::errc::bad_file_descriptor);
+    assert(invalid.error() == std::errc::bad_file_descriptor);
+}
+
+void run_find_next_integer_tests()
+{
+    constexpr std::string_view text
+        = "GET /metrics status=200 bytes=340282366920938463463374607431768211455 "
+          "delta=-170141183460469231731687303715884105728 -- id:ff-x";
+    const char* const last = text.data() + text.size();
+
+    uint128_t u128 {};
+    auto result = find_next_integer(text.data(), last, u128);
+    assert(result.ec == std::errc {});
+    assert(std::string_view(result.first, result.ptr) == "200");
+    assert(u128 == 200);
+
+    result = find_next_integer(result.ptr, last, u128);
+    assert(result.ec == std::errc {});
+    assert(u128 == u128_max);
+
+    // Unsigned types never consider a minus sign to be part of the token.
+    result = find_next_integer(result.ptr, last, u128);
+    assert(result.ec == std::errc {});
+    assert(std::string_view(result.first, result.ptr) == "170141183460469231731687303715884105728");
+
+    int128_t i128 {};
+    result = find_next_integer(text.data() + text.find("delta"), last, i128);
+    assert(result.ec == std::errc {});
+    assert(*result.first == '-');
+    assert(i128 == i128_min);
+
+    // A lone "--" is skipped, and "i" is not a hexadecimal digit.
+    result = find_next_integer(result.ptr, last, i128, 16);
+    assert(result.ec == std::errc {});
+    assert(std::string_view(result.first, result.ptr) == "d");
+
+    result = find_next_integer(result.ptr, last, i128, 16);
+    assert(result.ec == std::errc {});
+    assert(std::string_view(result.first, result.ptr) == "ff");
+
+    result = find_next_integer(result.ptr, last, i128);
+    assert(result.ec == std::errc::invalid_argument);
+    assert(result.first == last);
+
+    constexpr std::string_view too_large
+        = "................x=3402823669209384634633746074317682114550";
+    result = find_next_integer(too_large.data(), too_large.data() + too_large.size(), u128);
+    assert(result.ec == std::errc::result_out_of_range);
+    assert(result.ptr == too_large.data() + too_large.size());
+
+    // The vectorized search has to find tokens at any position relative to its blocks.
+    for (std::size_t i = 0; i < 48; ++i) {
+        char buffer[64];
+        std::ranges::fill(buffer, 'z');
+        buffer[i] = '-';
+        buffer[i + 1] = '7';
+        int128_t value {};
+        result = find_next_integer(buffer, std::end(buffer), value);
+        assert(result.ec == std::errc {});
+        assert(result.first == buffer + i);
+        assert(value == -7);
+    }
+}
+
+std::string_view format_fixed_point(
+    char (&buffer)[512], //
+    const auto value,
+    const int fraction_bits,
+    const int precision = -1
+)
+{
+    const auto [p, ec] = to_chars_fixed_point(
+        buffer, std::end(buffer), value, fraction_bits, precision
+    );
+    assert(ec == std::errc {});
+    return { buffer, p };
+}
+
+// Rounds an exact decimal expansion to `precision` fractional digits, half to even.
+std::string round_decimal_string(const std::string_view exact, const int precision)
+{
+    const std::size_t point = exact.find('.');
+    std::string digits(exact.substr(0, point));
+    std::string fraction(point == exact.npos ? "" : exact.substr(point + 1));
+    fraction.resize(std::max(fraction.size(), std::size_t(precision) + 1), '0');
+
+    std::string result = digits + fraction.substr(0, std::size_t(precision));
+    const char next = fraction[std::size_t(precision)];
+    const bool rest = fraction.find_first_not_of('0', std::size_t(precision) + 1) != fraction.npos;
+    const bool odd = (result.back() - '0') % 2 != 0;
+    if (next > '5' || (next == '5' && (rest || odd))) {
+        std::size_t i = result.size();
+        while (i != 0 && result[i - 1] == '9') {
+            result[--i] = '0';
+        }
+        if (i == 0) {
+            result.insert(result.begin(), '1');
+        }
+        else {
+            ++result[i - 1];
+        }
+    }
+    const std::size_t integer_digits = result.size() - std::size_t(precision);
+    if (precision != 0) {
+        result.insert(integer_digits, ".");
+    }
+    return result;
+}
+
+void run_fixed_point_tests()
+{
+    char buffer[512];
+    constexpr uint128_t one_64 = uint128_t(1) << 64;
+
+    assert(format_fixed_point(buffer, one_64 * 3 / 2, 64) == "1.5");
+    assert(format_fixed_point(buffer, one_64 * 3 / 2, 64, 3) == "1.500");
+    assert(format_fixed_point(buffer, one_64 * 3 / 2, 64, 0) == "2");
+    assert(format_fixed_point(buffer, one_64 * 5 / 2, 64, 0) == "2");
+    assert(format_fixed_point(buffer, uint128_t(7), 0) == "7");
+    assert(format_fixed_point(buffer, uint128_t(7), 0, 2) == "7.00");
+    assert(format_fixed_point(buffer, uint128_t(1), 128)
+           == "0.00000000000000000000000000000000000000293873587705571876992184134305561419"
+              "454666389193021880377187926569604314863681793212890625");
+    assert(format_fixed_point(buffer, u128_max, 1) == "170141183460469231731687303715884105727.5");
+    assert(format_fixed_point(buffer, u128_max, 1, 0) == "170141183460469231731687303715884105728");
+    assert(format_fixed_point(buffer, int128_t(-3), 1) == "-1.5");
+    assert(format_fixed_point(buffer, i128_min, 127) == "-1");
+    assert(format_fixed_point(buffer, i128_min + 1, 127, 2) == "-1.00");
+
+    // 0.1 in Q64.64 is rounded to an even significand with 63 fractional bits and digits.
+    uint128_t u128 {};
+    constexpr std::string_view tenth = "0.1";
+    auto result = from_chars_fixed_point(tenth.data(), tenth.data() + tenth.size(), u128, 64);
+    assert(result.ec == std::errc {});
+    assert(u128 == 0x199999999999999a);
+    assert(format_fixed_point(buffer, u128, 64, 19) == "0.1000000000000000000");
+    assert(format_fixed_point(buffer, u128, 64).size() == 2 + 63);
+
+    const auto parse = [](const std::string_view str, auto& value, const int fraction_bits) {
+        return from_chars_fixed_point(str.data(), str.data() + str.size(), value, fraction_bits);
+    };
+
+    // Ties round to even, and any nonzero digit after a tie rounds up.
+    assert(parse("0.5", u128, 0).ec == std::errc {} && u128 == 0);
+    assert(parse("1.5", u128, 0).ec == std::errc {} && u128 == 2);
+    assert(parse("0.50000000000000000000000000000001", u128, 0).ec == std::errc {} && u128 == 1);
+    assert(parse("0.375", u128, 2).ec == std::errc {} && u128 == 2);
+    assert(parse("0.125", u128, 2).ec == std::errc {} && u128 == 0);
+    assert(parse("0.1250000000000000000000000000000000000001", u128, 2).ec == std::errc {});
+    assert(u128 == 1);
+    assert(parse("0.99999999999999999999999", u128, 64).ec == std::errc {} && u128 == one_64);
+
+    // A point is only part of the number if a digit follows it.
+    result = parse("12.x", u128, 4);
+    assert(result.ec == std::errc {} && u128 == 12 * 16 && *result.ptr == '.');
+    assert(parse(".5", u128, 4).ec == std::errc::invalid_argument);
+
+    assert(parse("0.99", u128, 128).ec == std::errc {} && u128 == u128_max / 100 * 99 + 55);
+    assert(parse("1", u128, 128).ec == std::errc::result_out_of_range);
+    assert(parse("0.9999999999999999999999999999999999999999", u128, 128).ec
+           == std::errc::result_out_of_range);
+    assert(parse("65535.99999", u128, 112).ec == std::errc {});
+    assert(parse("65536", u128, 112).ec == std::errc::result_out_of_range);
+    result = parse("65535.9999999999999999999999999999999999999999x", u128, 112);
+    assert(result.ec == std::errc::result_out_of_range && *result.ptr == 'x');
+
+    int128_t i128 {};
+    assert(parse("-1", i128, 127).ec == std::errc {} && i128 == i128_min);
+    assert(parse("1", i128, 127).ec == std::errc::result_out_of_range);
+    assert(parse("-2.25", i128, 2).ec == std::errc {} && i128 == -9);
+    assert(parse("-", i128, 2).ec == std::errc::invalid_argument);
+
+    // Compare against exact expansions, rounded as strings, and parse everything back.
+    std::mt19937_64 engine { 81 };
+    for (int i = 0; i < 20000; ++i) {
+        const int fraction_bits = int(engine() % 129);
+        const uint128_t value = uint128_t(engine()) << 64 | engine();
+        const std::string exact(format_fixed_point(buffer, value, fraction_bits));
+
+        assert(parse(exact, u128, fraction_bits).ec == std::errc {});
+        assert(u128 == value);
+
+        const int precision = int(engine() % 45);
+        assert(format_fixed_point(buffer, value, fraction_bits, precision)
+               == round_decimal_string(exact, precision));
+    }
+}
+
+#ifdef CHARCONV_EXT_128_BIT_IMPLEMENTATION
+// The 64-bit digit engine does not depend on the standard library,
+// so conversions can be constant-evaluated.
+static_assert([] {
+    char buffer[64] {};
+    const auto [p, ec] = to_chars(buffer, std::end(buffer), u128_max);
+    uint128_t value {};
+    const auto parsed = from_chars(buffer, p, value);
+    return ec == std::errc {} && parsed.ec == std::errc {} && parsed.ptr == p && value == u128_max
+        && std::string_view(buffer, p) == "340282366920938463463374607431768211455";
+}());
+
+static_assert([] {
+    constexpr std::string_view text = "temperature: -40 degrees";
+    int128_t value {};
+    const auto result = find_next_integer(text.data(), text.data() + text.size(), value);
+    return result.ec == std::errc {} && value == -40;
+}());
+#endif
+
 } // namespace
 
 #ifdef CHARCONV_EXT_BITINT_MAXWIDTH
@@ -213,6 +1775,15 @@ template std::from_chars_result from_chars(const char*, const char*, bit_int<100
 template std::from_chars_result from_chars(const char*, const char*, bit_int<128>&, int);
 template std::from_chars_result from_chars(const char*, const char*, bit_uint<100>&, int);
 template std::from_chars_result from_chars(const char*, const char*, bit_uint<128>&, int);
+
+template std::to_chars_result
+basic_converter<backend::scalar>::to_chars(char*, char*, bit_int<100>, int);
+template std::to_chars_result
+basic_converter<backend::scalar>::to_chars(char*, char*, bit_uint<8>, int);
+template std::from_chars_result
+basic_converter<backend::constant_time>::from_chars(const char*, const char*, bit_int<100>&, int);
+template std::from_chars_result
+basic_converter<backend::constant_time>::from_chars(const char*, const char*, bit_uint<8>&, int);
 #endif
 
 #endif
@@ -222,5 +1793,25 @@ template std::from_chars_result from_chars(const char*, const char*, bit_uint<12
 int main()
 {
     charconv_ext::run_manual_tests();
+    charconv_ext::run_from_chars_edge_cases(charconv_ext::from_chars_edge_cases_u128);
+    charconv_ext::run_from_chars_edge_cases(charconv_ext::from_chars_edge_cases_i128);
+    charconv_ext::run_small_value_tests();
+    charconv_ext::run_decimal_tests();
+    charconv_ext::run_iostream_tests();
     charconv_ext::run_fuzz_tests();
+    charconv_ext::run_binary_tests();
+    charconv_ext::run_find_next_integer_tests();
+    charconv_ext::run_fixed_point_tests();
+    charconv_ext::run_packed_tests();
+    charconv_ext::run_record_tests();
+    charconv_ext::run_decimal_column_tests();
+    charconv_ext::run_divider_tests();
+    charconv_ext::run_exact_float_tests();
+    charconv_ext::run_adaptive_tests();
+    charconv_ext::run_bitset_tests();
+    charconv_ext::run_packed_decimal_tests();
+    charconv_ext::run_backend_tests();
+    charconv_ext::run_increment_tests();
+    charconv_ext::run_sortable_tests();
+    charconv_ext::run_fd_writer_tests();
 }
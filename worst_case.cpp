@@ -0,0 +1,403 @@
+// Searches for inputs which maximize the latency of to_chars and from_chars
+// for the 128-bit and _BitInt overloads, in every base.
+//
+// For every combination of operation, type, and base, the search starts with inputs
+// from boundary generators, which are known to exercise the different paths
+// of the implementation, and then repeatedly mutates the slowest inputs found so far.
+// The slowest cases are reported at the end.
+//
+// Usage: charconv_ext_worst_case [mutations-per-target] [report-count]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include "charconv_ext/charconv_ext.hpp"
+
+namespace {
+
+using namespace charconv_ext;
+
+#if defined(__x86_64__) || defined(__i386__)
+constexpr std::string_view time_unit = "cycles";
+
+std::uint64_t timestamp()
+{
+    return __rdtsc();
+}
+#else
+constexpr std::string_view time_unit = "ns";
+
+std::uint64_t timestamp()
+{
+    const auto now = std::chrono::steady_clock::now().time_since_epoch();
+    return std::uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(now).count());
+}
+#endif
+
+template <typename T>
+void do_not_optimize(const T& value)
+{
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/// @brief Returns the time per call of `f`, as the minimum over several repetitions,
+/// which filters out interrupts and other noise.
+template <typename F>
+double measure(F&& f)
+{
+    constexpr int repetitions = 7;
+    constexpr int calls = 32;
+
+    double best = 1e300;
+    for (int r = 0; r < repetitions; ++r) {
+        const std::uint64_t start = timestamp();
+        for (int i = 0; i < calls; ++i) {
+            f();
+        }
+        const std::uint64_t end = timestamp();
+        best = std::min(best, double(end - start) / calls);
+    }
+    return best;
+}
+
+template <typename T>
+struct limits;
+
+template <>
+struct limits<uint128_t> {
+    static constexpr std::string_view name = "uint128_t";
+    static constexpr int bits = 128;
+    static constexpr uint128_t min = 0;
+    static constexpr uint128_t max = uint128_t(-1);
+};
+
+template <>
+struct limits<int128_t> {
+    static constexpr std::string_view name = "int128_t";
+    static constexpr int bits = 128;
+    static constexpr int128_t max = int128_t(uint128_t(-1) >> 1);
+    static constexpr int128_t min = -max - 1;
+};
+
+#ifdef CHARCONV_EXT_BITINT_MAXWIDTH
+// Bit-precise integers with at most 64 bits take a different path than wider ones.
+template <>
+struct limits<bit_int<48>> {
+    static constexpr std::string_view name = "bit_int<48>";
+    static constexpr int bits = 48;
+    static constexpr bit_int<48> max = bit_int<48>(bit_uint<48>(-1) >> 1);
+    static constexpr bit_int<48> min = -max - 1;
+};
+
+template <>
+struct limits<bit_uint<72>> {
+    static constexpr std::string_view name = "bit_uint<72>";
+    static constexpr int bits = 72;
+    static constexpr bit_uint<72> min = 0;
+    static constexpr bit_uint<72> max = bit_uint<72>(-1);
+};
+
+template <>
+struct limits<bit_int<100>> {
+    static constexpr std::string_view name = "bit_int<100>";
+    static constexpr int bits = 100;
+    static constexpr bit_int<100> max = bit_int<100>(bit_uint<100>(-1) >> 1);
+    static constexpr bit_int<100> min = -max - 1;
+};
+#endif
+
+struct finding {
+    std::string operation;
+    int base;
+    std::string input;
+    double time;
+};
+
+std::string format(const auto value, const int base)
+{
+    char buffer[256];
+    const auto [p, ec] = charconv_ext::to_chars(buffer, std::end(buffer), value, base);
+    return std::string(buffer, ec == std::errc {} ? p : buffer);
+}
+
+/// @brief Returns values which exercise the boundaries between the paths of `to_chars`
+/// and `from_chars`, converted to `T` with wrap-around.
+template <typename T>
+std::vector<T> boundary_values(const int base)
+{
+    constexpr uint128_t u64_max = std::uint64_t(-1);
+    const std::uint64_t max_pow = detail::u64_max_power(base);
+    const uint128_t chunk = max_pow == 0 ? uint128_t(1) << 64 : uint128_t(max_pow);
+
+    std::vector<uint128_t> raw {
+        0, 1, uint128_t(base - 1), u64_max - 1, u64_max, u64_max + 1, u64_max + uint128_t(base),
+        chunk - 1, chunk, chunk + 1,
+    };
+    if (max_pow != 0) {
+        raw.insert(raw.end(), { chunk * chunk - 1, chunk * chunk, chunk * chunk + 1 });
+    }
+    // Every digit count, at its smallest and largest value.
+    for (uint128_t power = uint128_t(base);; power *= uint128_t(base)) {
+        raw.push_back(power - 1);
+        raw.push_back(power);
+        if (power > uint128_t(-1) / uint128_t(base)) {
+            break;
+        }
+    }
+
+    std::vector<T> result { limits<T>::min, limits<T>::max, T(limits<T>::min + 1) };
+    for (const uint128_t value : raw) {
+        result.push_back(T(value));
+        result.push_back(T(-value));
+    }
+    return result;
+}
+
+/// @brief Returns strings which are expensive or unusual to parse:
+/// every boundary value, leading-zero floods, and strings just past the range of `T`.
+template <typename T>
+std::vector<std::string> boundary_strings(const int base)
+{
+    std::vector<std::string> result;
+    for (const T value : boundary_values<T>(base)) {
+        result.push_back(format(value, base));
+    }
+
+    const std::string max = format(limits<T>::max, base);
+    const std::string highest_digit(1, detail::digit_chars[base - 1]);
+    std::string max_plus_one = max;
+    for (auto it = max_plus_one.rbegin();; ++it) {
+        if (it == max_plus_one.rend()) {
+            max_plus_one.insert(max_plus_one.begin(), '1');
+            break;
+        }
+        if (*it != highest_digit[0]) {
+            *it = detail::digit_chars[detail::digit_value(*it) + 1];
+            break;
+        }
+        *it = '0';
+    }
+
+    for (const std::size_t zeros : { 1, 64, 1000 }) {
+        result.push_back(std::string(zeros, '0') + max);
+        result.push_back(std::string(zeros, '0') + "1");
+    }
+    result.push_back(max_plus_one);
+    result.push_back(max + "0");
+    result.push_back(std::string(max.size(), highest_digit[0]));
+    result.push_back(std::string(max.size() * 4, highest_digit[0]));
+    if (limits<T>::min != 0) {
+        std::string negative = "-";
+        result.push_back(negative.append(max_plus_one));
+        negative = "-";
+        result.push_back(negative.append(1000, '0').append(max));
+    }
+    return result;
+}
+
+class searcher {
+public:
+    searcher(const int mutations, const std::uint64_t seed)
+        : m_mutations(mutations)
+        , m_rng(seed)
+    {
+    }
+
+    template <typename T>
+    void search_to_chars(const int base)
+    {
+        const auto time_of = [base](const T value) {
+            char buffer[256];
+            return measure([&] {
+                T input = value;
+                do_not_optimize(input);
+                const auto result = charconv_ext::to_chars(buffer, std::end(buffer), input, base);
+                do_not_optimize(result);
+            });
+        };
+        // The arithmetic happens in uint128_t, so that it wraps around instead of overflowing.
+        const auto mutate = [&](const T value) {
+            const auto bits = uint128_t(value);
+            switch (m_rng() % 4) {
+            case 0: return T(bits ^ uint128_t(1) << (m_rng() % limits<T>::bits));
+            case 1: return T(bits + m_rng() % 1024 - 512);
+            case 2: return T(bits * uint128_t(base));
+            default: return T(value / T(base));
+            }
+        };
+        const auto describe = [base](const T value) { return format(value, base); };
+        const std::string operation = "to_chars(" + std::string(limits<T>::name) + ")";
+        run<T>(operation, base, boundary_values<T>(base), time_of, mutate, describe);
+    }
+
+    template <typename T>
+    void search_from_chars(const int base)
+    {
+        const auto time_of = [base](const std::string& input) {
+            return measure([&] {
+                const char* first = input.data();
+                do_not_optimize(first);
+                T value {};
+                const auto result
+                    = charconv_ext::from_chars(first, first + input.size(), value, base);
+                do_not_optimize(result);
+                do_not_optimize(value);
+            });
+        };
+        const auto mutate = [&](std::string input) {
+            constexpr std::size_t max_length = 4096;
+            const std::size_t position = m_rng() % (input.size() + 1);
+            const char digit = detail::digit_chars[m_rng() % std::uint64_t(base)];
+            switch (m_rng() % 4) {
+            case 0:
+                if (position != input.size() && input[position] != '-') {
+                    input[position] = digit;
+                }
+                break;
+            case 1:
+                if (input.size() < max_length) {
+                    input.insert(input.begin() + std::ptrdiff_t(position), digit);
+                }
+                break;
+            case 2:
+                if (input.size() > 1 && position != input.size()) {
+                    input.erase(input.begin() + std::ptrdiff_t(position));
+                }
+                break;
+            default: {
+                const std::size_t zeros = std::min(m_rng() % 256, max_length - input.size());
+                input.insert(std::size_t(input[0] == '-'), zeros, '0');
+                break;
+            }
+            }
+            return input;
+        };
+        const auto describe = [](const std::string& input) { return input; };
+        const std::string operation = "from_chars(" + std::string(limits<T>::name) + ")";
+        run<std::string>(operation, base, boundary_strings<T>(base), time_of, mutate, describe);
+    }
+
+    std::vector<finding>& findings()
+    {
+        return m_findings;
+    }
+
+private:
+    int m_mutations;
+    std::mt19937_64 m_rng;
+    std::vector<finding> m_findings;
+
+    /// @brief Measures every seed, and then repeatedly mutates one of the slowest inputs,
+    /// keeping the mutation if it is slower than the fastest input in the pool.
+    template <typename Input>
+    void run(
+        const std::string& operation, //
+        const int base,
+        const std::vector<Input>& seeds,
+        const auto& time_of,
+        const auto& mutate,
+        const auto& describe
+    )
+    {
+        constexpr std::size_t pool_size = 8;
+        using entry = std::pair<double, Input>;
+        std::vector<entry> pool;
+        const auto consider = [&](const Input& input) {
+            const double time = time_of(input);
+            if (pool.size() < pool_size) {
+                pool.emplace_back(time, input);
+                return;
+            }
+            const auto fastest = std::ranges::min_element(pool, {}, &entry::first);
+            if (time > fastest->first) {
+                *fastest = { time, input };
+            }
+        };
+
+        for (const Input& seed : seeds) {
+            consider(seed);
+        }
+        for (int i = 0; i < m_mutations; ++i) {
+            consider(mutate(pool[m_rng() % pool.size()].second));
+        }
+
+        const auto slowest = std::ranges::max_element(pool, {}, &entry::first);
+        m_findings.push_back({ operation, base, describe(slowest->second), slowest->first });
+    }
+};
+
+template <typename T>
+void search_all_bases(searcher& s)
+{
+    for (int base = 2; base <= 36; ++base) {
+        s.search_to_chars<T>(base);
+        s.search_from_chars<T>(base);
+    }
+}
+
+void print(const finding& f)
+{
+    constexpr std::size_t max_shown = 48;
+    std::string input = f.input;
+    if (input.size() > max_shown) {
+        input = input.substr(0, max_shown / 2) + "..." + input.substr(input.size() - max_shown / 2);
+    }
+    std::cout << std::setw(26) << std::left << f.operation << " base " << std::setw(3) << f.base
+              << std::setw(10) << std::right << std::fixed << std::setprecision(1) << f.time << ' '
+              << time_unit << "  [" << f.input.size() << " chars] " << input << '\n';
+}
+
+} // namespace
+
+int main(const int argc, const char* const* const argv)
+{
+    const int mutations = argc > 1 ? std::atoi(argv[1]) : 2000;
+    const std::size_t report_count = argc > 2 ? std::size_t(std::atoi(argv[2])) : 20;
+
+    searcher s { mutations, 0x085 };
+    search_all_bases<uint128_t>(s);
+    search_all_bases<int128_t>(s);
+#ifdef CHARCONV_EXT_BITINT_MAXWIDTH
+    search_all_bases<bit_int<48>>(s);
+    search_all_bases<bit_uint<72>>(s);
+    search_all_bases<bit_int<100>>(s);
+#endif
+
+    std::vector<finding>& findings = s.findings();
+
+    std::cout << "Slowest input per operation:\n";
+    std::vector<std::string> operations;
+    for (const finding& f : findings) {
+        if (std::ranges::find(operations, f.operation) == operations.end()) {
+            operations.push_back(f.operation);
+        }
+    }
+    for (const std::string& operation : operations) {
+        const finding* slowest = nullptr;
+        for (const finding& f : findings) {
+            if (f.operation == operation && (slowest == nullptr || f.time > slowest->time)) {
+                slowest = &f;
+            }
+        }
+        print(*slowest);
+    }
+
+    std::ranges::sort(findings, std::greater<> {}, &finding::time);
+    findings.resize(std::min(findings.size(), report_count));
+    std::cout << "\nSlowest cases overall:\n";
+    for (const finding& f : findings) {
+        print(f);
+    }
+}